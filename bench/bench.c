@@ -0,0 +1,602 @@
+#define _GNU_SOURCE // wait4, nftw
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/ptrace.h>
+#endif
+
+#define BENCH_WRITE_BUF (1u << 20)
+#define BENCH_MAX_ARGS 8
+#define BENCH_MAX_REPS 100
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s gen DIR [-s MiB] [-n tiny_files] [-S seed]\n", prog);
+    fprintf(stderr, "       %s run DIR [-t bindir] [-r reps] [-c hot|cold|both] [-o out.json] [-b baseline.json] [-T pct] [-x] [-k case]\n", prog);
+}
+
+// ---- corpus ----
+
+typedef struct gen_ctx {
+    uint64_t rng;
+    unsigned char *buf;
+    size_t len;
+    int fd;
+    int error;
+} gen_ctx_t;
+
+static inline uint64_t splitmix64(uint64_t *s) {
+    uint64_t z = (*s += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static inline unsigned rnd(gen_ctx_t *g, unsigned n) {
+    return (unsigned)(splitmix64(&g->rng) % n);
+}
+
+static void gen_flush(gen_ctx_t *g) {
+    size_t off = 0;
+    while (off < g->len && !g->error) {
+        ssize_t n = write(g->fd, g->buf + off, g->len - off);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            g->error = errno;
+            break;
+        }
+        off += (size_t)n;
+    }
+    g->len = 0;
+}
+
+static inline void gen_put(gen_ctx_t *g, unsigned char c) {
+    if (g->len == BENCH_WRITE_BUF) gen_flush(g);
+    g->buf[g->len++] = c;
+}
+
+static int gen_open(gen_ctx_t *g, const char *dir, const char *name) {
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    g->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (g->fd < 0) {
+        fprintf(stderr, "bench: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    g->len = 0;
+    g->error = 0;
+    return 0;
+}
+
+static int gen_close(gen_ctx_t *g, const char *name) {
+    gen_flush(g);
+    if (close(g->fd) != 0 && !g->error) g->error = errno;
+    if (g->error) fprintf(stderr, "bench: %s: %s\n", name, strerror(g->error));
+    return g->error ? -1 : 0;
+}
+
+// Lines of pseudo-words; line length in words is drawn from [0, max_words].
+static int gen_text(gen_ctx_t *g, const char *dir, const char *name, unsigned long long bytes, unsigned max_words) {
+    if (gen_open(g, dir, name) != 0) return -1;
+    unsigned long long n = 0;
+    while (n < bytes) {
+        unsigned words = rnd(g, max_words + 1);
+        for (unsigned w = 0; w < words && n < bytes; ++w) {
+            unsigned wl = 1 + rnd(g, 10);
+            for (unsigned i = 0; i < wl; ++i, ++n) gen_put(g, (unsigned char)('a' + rnd(g, 26)));
+            if (w + 1 < words) {
+                gen_put(g, ' ');
+                n++;
+            }
+        }
+        gen_put(g, '\n');
+        n++;
+    }
+    return gen_close(g, name);
+}
+
+static int gen_binary(gen_ctx_t *g, const char *dir, const char *name, unsigned long long bytes) {
+    if (gen_open(g, dir, name) != 0) return -1;
+    for (unsigned long long n = 0; n < bytes; n += 8) {
+        uint64_t v = splitmix64(&g->rng);
+        for (int i = 0; i < 8 && n + (unsigned long long)i < bytes; ++i) gen_put(g, (unsigned char)(v >> (8 * i)));
+    }
+    return gen_close(g, name);
+}
+
+// One 4 KiB extent of data per MiB, the rest holes.
+static int gen_sparse(gen_ctx_t *g, const char *dir, const char *name, unsigned long long bytes) {
+    if (gen_open(g, dir, name) != 0) return -1;
+    if (ftruncate(g->fd, (off_t)bytes) != 0) g->error = errno;
+    unsigned char block[4096];
+    for (unsigned long long off = 0; !g->error && off + sizeof(block) <= bytes; off += 1u << 20) {
+        for (size_t i = 0; i < sizeof(block); ++i) block[i] = (unsigned char)rnd(g, 256);
+        if (pwrite(g->fd, block, sizeof(block), (off_t)off) != (ssize_t)sizeof(block)) g->error = errno ? errno : EIO;
+    }
+    return gen_close(g, name);
+}
+
+static int make_dir(const char *path) {
+    if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "bench: mkdir %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+static int gen_small_file(gen_ctx_t *g, const char *dir, const char *name, unsigned max_len) {
+    if (gen_open(g, dir, name) != 0) return -1;
+    unsigned len = rnd(g, max_len + 1);
+    for (unsigned i = 0; i < len; ++i) gen_put(g, (unsigned char)('a' + rnd(g, 26)));
+    return gen_close(g, name);
+}
+
+static int gen_tree(gen_ctx_t *g, const char *root, unsigned long tiny) {
+    char path[4096], name[64];
+    snprintf(path, sizeof(path), "%s/tiny", root);
+    if (make_dir(path) != 0) return -1;
+    for (unsigned long i = 0; i < tiny; ++i) {
+        snprintf(name, sizeof(name), "f%07lu", i);
+        if (gen_small_file(g, path, name, 64) != 0) return -1;
+    }
+    // wide: 1000 directories of 20 files
+    snprintf(path, sizeof(path), "%s/wide", root);
+    if (make_dir(path) != 0) return -1;
+    for (unsigned d = 0; d < 1000; ++d) {
+        snprintf(path, sizeof(path), "%s/wide/d%04u", root, d);
+        if (make_dir(path) != 0) return -1;
+        for (unsigned f = 0; f < 20; ++f) {
+            snprintf(name, sizeof(name), "f%02u", f);
+            if (gen_small_file(g, path, name, 512) != 0) return -1;
+        }
+    }
+    // deep: a chain of 200 directories with 5 files each
+    size_t len = (size_t)snprintf(path, sizeof(path), "%s/deep", root);
+    for (unsigned d = 0; d < 200; ++d) {
+        if (make_dir(path) != 0) return -1;
+        for (unsigned f = 0; f < 5; ++f) {
+            snprintf(name, sizeof(name), "f%u", f);
+            if (gen_small_file(g, path, name, 512) != 0) return -1;
+        }
+        len += (size_t)snprintf(path + len, sizeof(path) - len, "/d%u", d % 10);
+    }
+    return 0;
+}
+
+static int cmd_gen(int argc, char **argv) {
+    unsigned long long mib = 64;
+    unsigned long tiny = 100000;
+    uint64_t seed = 1;
+    int c;
+    while ((c = getopt(argc, argv, "s:n:S:")) != -1) {
+        switch (c) {
+            case 's': mib = strtoull(optarg, NULL, 10); break;
+            case 'n': tiny = strtoul(optarg, NULL, 10); break;
+            case 'S': seed = strtoull(optarg, NULL, 10); break;
+            default: return 2;
+        }
+    }
+    if (optind + 1 != argc) return 2;
+    const char *dir = argv[optind];
+    if (make_dir(dir) != 0) return 1;
+    gen_ctx_t g;
+    memset(&g, 0, sizeof(g));
+    g.rng = seed;
+    g.buf = (unsigned char *)malloc(BENCH_WRITE_BUF);
+    if (!g.buf) {
+        perror("bench: malloc");
+        return 1;
+    }
+    unsigned long long bytes = mib << 20;
+    int rc = gen_text(&g, dir, "text.txt", bytes, 16) ||
+             gen_text(&g, dir, "long_lines.txt", bytes, 12000) ||
+             gen_text(&g, dir, "short_lines.txt", bytes, 1) ||
+             gen_binary(&g, dir, "binary.bin", bytes) ||
+             gen_sparse(&g, dir, "sparse.bin", bytes * 4) ||
+             gen_tree(&g, dir, tiny);
+    free(g.buf);
+    if (rc) return 1;
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/out", dir);
+    if (make_dir(path) != 0) return 1;
+    snprintf(path, sizeof(path), "%s/corpus.txt", dir);
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror("bench: corpus.txt");
+        return 1;
+    }
+    fprintf(f, "seed %llu\nmib %llu\ntiny %lu\n", (unsigned long long)seed, mib, tiny);
+    fclose(f);
+    sync(); // cold runs can then drop pages without writing them back first
+    return 0;
+}
+
+// ---- runner ----
+
+typedef enum { UNIT_BYTES, UNIT_ENTRIES } bench_unit_t;
+
+typedef struct bench_case {
+    const char *name;
+    const char *tool;
+    const char *args[BENCH_MAX_ARGS];   // "@" is replaced by the corpus path of input
+    const char *input;                  // relative to the corpus; evicted for cold runs
+    bench_unit_t unit;
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+    { "wc/text",            "wc",    { "@" },                 "text.txt",        UNIT_BYTES },
+    { "wc/long_lines",      "wc",    { "@" },                 "long_lines.txt",  UNIT_BYTES },
+    { "wc/short_lines",     "wc",    { "@" },                 "short_lines.txt", UNIT_BYTES },
+    { "wc/binary",          "wc",    { "@" },                 "binary.bin",      UNIT_BYTES },
+    { "cat/text",           "cat",   { "@" },                 "text.txt",        UNIT_BYTES },
+    { "cat/number",         "cat",   { "-n", "@" },           "text.txt",        UNIT_BYTES },
+    { "cat/binary",         "cat",   { "@" },                 "binary.bin",      UNIT_BYTES },
+    { "cp/binary",          "cp",    { "@", "out/cp.bin" },   "binary.bin",      UNIT_BYTES },
+    { "cp/sparse",          "cp",    { "@", "out/cp.sparse" },"sparse.bin",      UNIT_BYTES },
+    { "cksum/binary",       "cksum", { "@" },                 "binary.bin",      UNIT_BYTES },
+    { "cksum/crc32c",       "cksum", { "-a", "crc32c", "@" }, "binary.bin",      UNIT_BYTES },
+    { "cksum/sparse",       "cksum", { "@" },                 "sparse.bin",      UNIT_BYTES },
+    { "cksum/count",        "cksum", { "--count", "@" },      "text.txt",        UNIT_BYTES },
+    { "ls/tiny",            "ls",    { "@" },                 "tiny",            UNIT_ENTRIES },
+    { "ls/tiny_unsorted",   "ls",    { "-f", "@" },           "tiny",            UNIT_ENTRIES },
+    { "ls/tiny_long",       "ls",    { "-l", "@" },           "tiny",            UNIT_ENTRIES },
+    { "ls/wide_recursive",  "ls",    { "-lR", "@" },          "wide",            UNIT_ENTRIES },
+    { "ls/deep_recursive",  "ls",    { "-aR", "@" },          "deep",            UNIT_ENTRIES },
+};
+
+#define BENCH_NCASES (sizeof(cases) / sizeof(cases[0]))
+
+typedef struct bench_sample {
+    double wall, user, sys;
+    long max_rss_kb;
+    long in_blocks;
+    long ctx_switches;
+    int status;
+} bench_sample_t;
+
+typedef struct bench_result {
+    const bench_case_t *c;
+    const char *cache;
+    bench_sample_t median;
+    long syscalls;          // -1 when not counted
+    unsigned long long amount;
+} bench_result_t;
+
+static unsigned long long walk_amount;
+static bench_unit_t walk_unit;
+static int walk_evict;
+
+static int walk_entry(const char *path, const struct stat *st, int type, struct FTW *ftw) {
+    (void)ftw;
+    if (walk_unit == UNIT_ENTRIES) walk_amount++;
+    if (type != FTW_F) return 0;
+    if (walk_unit == UNIT_BYTES) walk_amount += (unsigned long long)st->st_size;
+    if (walk_evict) {
+        int fd = open(path, O_RDONLY);
+        if (fd >= 0) {
+#ifdef POSIX_FADV_DONTNEED
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+            close(fd);
+        }
+    }
+    return 0;
+}
+
+// Bytes or entries under path; with evict, file pages are dropped from the
+// page cache as well (dentries and inodes stay, there is no portable way).
+static unsigned long long scan_input(const char *path, bench_unit_t unit, int evict) {
+    walk_amount = 0;
+    walk_unit = unit;
+    walk_evict = evict;
+    nftw(path, walk_entry, 64, FTW_PHYS);
+    if (unit == UNIT_ENTRIES && walk_amount > 0) walk_amount--; // the root itself
+    return walk_amount;
+}
+
+static inline double tv_sec(const struct timeval *tv) {
+    return (double)tv->tv_sec + (double)tv->tv_usec / 1e6;
+}
+
+static void child_exec(const char *corpus, char *const argv[]) {
+    int null = open("/dev/null", O_WRONLY);
+    if (null >= 0) {
+        dup2(null, STDOUT_FILENO);
+        close(null);
+    }
+    if (chdir(corpus) != 0) _exit(127);
+    execv(argv[0], argv);
+    _exit(127);
+}
+
+static int run_once(const char *corpus, char *const argv[], bench_sample_t *s) {
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("bench: fork");
+        return -1;
+    }
+    if (pid == 0) child_exec(corpus, argv);
+    int status;
+    struct rusage ru;
+    if (wait4(pid, &status, 0, &ru) != pid) {
+        perror("bench: wait4");
+        return -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    s->wall = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+    s->user = tv_sec(&ru.ru_utime);
+    s->sys = tv_sec(&ru.ru_stime);
+    s->max_rss_kb = ru.ru_maxrss;
+    s->in_blocks = ru.ru_inblock;
+    s->ctx_switches = ru.ru_nvcsw + ru.ru_nivcsw;
+    s->status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+    return 0;
+}
+
+// Syscall entries of the tool and all its threads, from a separate traced
+// run so the timed runs are not slowed down. -1 if tracing is unavailable.
+static long count_syscalls(const char *corpus, char *const argv[]) {
+#if defined(__linux__) && defined(PTRACE_GET_SYSCALL_INFO)
+    pid_t pid = fork();
+    if (pid < 0) return -1;
+    if (pid == 0) {
+        if (ptrace(PTRACE_TRACEME, 0, NULL, NULL) != 0) _exit(127);
+        raise(SIGSTOP);
+        child_exec(corpus, argv);
+    }
+    int status;
+    if (waitpid(pid, &status, 0) != pid || !WIFSTOPPED(status)) return -1;
+    long opts = PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACECLONE | PTRACE_O_TRACEEXEC | PTRACE_O_EXITKILL;
+    if (ptrace(PTRACE_SETOPTIONS, pid, NULL, (void *)opts) != 0) {
+        kill(pid, SIGKILL);
+        waitpid(pid, &status, 0);
+        return -1;
+    }
+    long calls = 0;
+    ptrace(PTRACE_SYSCALL, pid, NULL, NULL);
+    for (;;) {
+        pid_t tid = waitpid(-1, &status, __WALL);
+        if (tid < 0) break; // ECHILD: every thread is gone
+        if (!WIFSTOPPED(status)) continue;
+        int sig = WSTOPSIG(status);
+        if (sig == (SIGTRAP | 0x80)) {
+            struct __ptrace_syscall_info info;
+            if (ptrace(PTRACE_GET_SYSCALL_INFO, tid, (void *)sizeof(info), &info) > 0 &&
+                info.op == PTRACE_SYSCALL_INFO_ENTRY) {
+                calls++;
+            }
+            sig = 0;
+        } else if (sig == SIGTRAP || sig == SIGSTOP) {
+            sig = 0; // ptrace events and the initial stop of new threads
+        }
+        ptrace(PTRACE_SYSCALL, tid, NULL, (void *)(long)sig);
+    }
+    return calls;
+#else
+    (void)corpus;
+    (void)argv;
+    return -1;
+#endif
+}
+
+static int cmp_wall(const void *a, const void *b) {
+    double x = ((const bench_sample_t *)a)->wall, y = ((const bench_sample_t *)b)->wall;
+    return (x > y) - (x < y);
+}
+
+typedef struct bench_run {
+    const char *corpus;
+    const char *bindir;
+    int reps;
+    int syscalls;
+} bench_run_t;
+
+static int run_case(const bench_run_t *run, const bench_case_t *c, int cold, bench_result_t *out) {
+    char bin[4096], input[4096];
+    snprintf(bin, sizeof(bin), "%s/%s", run->bindir, c->tool);
+    snprintf(input, sizeof(input), "%s/%s", run->corpus, c->input);
+    char *argv[BENCH_MAX_ARGS + 2];
+    int argc = 0;
+    argv[argc++] = bin;
+    for (int i = 0; i < BENCH_MAX_ARGS && c->args[i]; ++i) {
+        argv[argc++] = (char *)(strcmp(c->args[i], "@") == 0 ? c->input : c->args[i]);
+    }
+    argv[argc] = NULL;
+
+    bench_sample_t samples[BENCH_MAX_REPS];
+    int warm = !cold; // one untimed run fills the cache for hot runs
+    for (int r = 0; r < run->reps + warm; ++r) {
+        scan_input(input, c->unit, cold);
+        bench_sample_t s;
+        if (run_once(run->corpus, argv, &s) != 0) return -1;
+        if (r >= warm) samples[r - warm] = s;
+    }
+    qsort(samples, (size_t)run->reps, sizeof(bench_sample_t), cmp_wall);
+    out->c = c;
+    out->cache = cold ? "cold" : "hot";
+    out->median = samples[run->reps / 2];
+    out->amount = scan_input(input, c->unit, 0);
+    out->syscalls = -1;
+    if (run->syscalls) {
+        scan_input(input, c->unit, cold);
+        out->syscalls = count_syscalls(run->corpus, argv);
+    }
+    return 0;
+}
+
+static void write_result(FILE *f, const bench_result_t *r, int last) {
+    const bench_sample_t *s = &r->median;
+    double per_s = s->wall > 0 ? (double)r->amount / s->wall : 0;
+    // One result per line; load_baseline depends on it.
+    fprintf(f, "    {\"name\": \"%s\", \"cache\": \"%s\", \"exit\": %d, \"wall_s\": %.6f, "
+               "\"user_s\": %.6f, \"sys_s\": %.6f, \"max_rss_kb\": %ld, \"in_blocks\": %ld, "
+               "\"ctx_switches\": %ld, \"syscalls\": %ld, \"unit\": \"%s\", \"amount\": %llu, "
+               "\"per_s\": %.1f}%s\n",
+            r->c->name, r->cache, s->status, s->wall, s->user, s->sys, s->max_rss_kb,
+            s->in_blocks, s->ctx_switches, r->syscalls, r->c->unit == UNIT_BYTES ? "bytes" : "entries",
+            r->amount, per_s, last ? "" : ",");
+}
+
+typedef struct baseline {
+    char name[64];
+    char cache[8];
+    double wall;
+} baseline_t;
+
+static baseline_t *load_baseline(const char *path, size_t *n) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "bench: baseline %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+    baseline_t *b = NULL;
+    size_t cap = 0;
+    *n = 0;
+    char line[1024];
+    while (fgets(line, sizeof(line), f)) {
+        baseline_t e;
+        const char *w = strstr(line, "\"wall_s\": ");
+        if (!w || sscanf(line, " {\"name\": \"%63[^\"]\", \"cache\": \"%7[^\"]\"", e.name, e.cache) != 2) continue;
+        e.wall = strtod(w + 10, NULL);
+        if (*n == cap) {
+            cap = cap ? cap * 2 : 64;
+            baseline_t *nb = (baseline_t *)realloc(b, cap * sizeof(baseline_t));
+            if (!nb) break;
+            b = nb;
+        }
+        b[(*n)++] = e;
+    }
+    fclose(f);
+    return b;
+}
+
+// Prints one line per case found in the baseline; returns the number of
+// cases slower than the threshold.
+static int compare_baseline(const bench_result_t *res, size_t nres, const baseline_t *base, size_t nbase, double threshold) {
+    int regressions = 0;
+    for (size_t i = 0; i < nres; ++i) {
+        for (size_t j = 0; j < nbase; ++j) {
+            if (strcmp(base[j].name, res[i].c->name) != 0 || strcmp(base[j].cache, res[i].cache) != 0) continue;
+            double change = base[j].wall > 0 ? (res[i].median.wall / base[j].wall - 1.0) * 100.0 : 0;
+            int slow = change > threshold;
+            regressions += slow;
+            fprintf(stderr, "%-20s %-4s %10.4fs -> %10.4fs %+7.1f%%%s\n", res[i].c->name, res[i].cache,
+                    base[j].wall, res[i].median.wall, change, slow ? "  REGRESSION" : "");
+            break;
+        }
+    }
+    return regressions;
+}
+
+static int cmd_run(int argc, char **argv) {
+    bench_run_t run = { NULL, "bin", 5, 0 };
+    char *bindir;
+    const char *out_path = "bench_output.txt";
+    const char *baseline_path = NULL;
+    const char *only = NULL;
+    int hot = 1, cold = 1;
+    double threshold = 10.0;
+    int c;
+    while ((c = getopt(argc, argv, "t:r:c:o:b:T:xk:")) != -1) {
+        switch (c) {
+            case 't': run.bindir = optarg; break;
+            case 'r': run.reps = atoi(optarg); break;
+            case 'c':
+                hot = strcmp(optarg, "cold") != 0;
+                cold = strcmp(optarg, "hot") != 0;
+                break;
+            case 'o': out_path = optarg; break;
+            case 'b': baseline_path = optarg; break;
+            case 'T': threshold = atof(optarg); break;
+            case 'x': run.syscalls = 1; break;
+            case 'k': only = optarg; break;
+            default: return 2;
+        }
+    }
+    if (optind + 1 != argc || run.reps < 1 || run.reps > BENCH_MAX_REPS) return 2;
+    run.corpus = argv[optind];
+    // tools are exec'd from inside the corpus directory
+    bindir = realpath(run.bindir, NULL);
+    if (!bindir) {
+        fprintf(stderr, "bench: %s: %s\n", run.bindir, strerror(errno));
+        return 1;
+    }
+    run.bindir = bindir;
+
+    bench_result_t *res = (bench_result_t *)calloc(BENCH_NCASES * 2, sizeof(bench_result_t));
+    if (!res) {
+        perror("bench: calloc");
+        return 1;
+    }
+    size_t nres = 0;
+    for (size_t i = 0; i < BENCH_NCASES; ++i) {
+        if (only && strncmp(cases[i].name, only, strlen(only)) != 0) continue;
+        for (int mode = 0; mode < 2; ++mode) {
+            if (mode == 0 ? !hot : !cold) continue;
+            if (run_case(&run, &cases[i], mode, &res[nres]) != 0) {
+                free(res);
+                free(bindir);
+                return 1;
+            }
+            const bench_result_t *r = &res[nres++];
+            fprintf(stderr, "%-20s %-4s %10.4fs  rss %7ld KiB%s\n", r->c->name, r->cache, r->median.wall,
+                    r->median.max_rss_kb, r->median.status ? "  (failed)" : "");
+        }
+    }
+
+    FILE *f = fopen(out_path, "w");
+    if (!f) {
+        fprintf(stderr, "bench: %s: %s\n", out_path, strerror(errno));
+        free(res);
+        free(bindir);
+        return 1;
+    }
+    fprintf(f, "{\n  \"corpus\": \"%s\",\n  \"reps\": %d,\n  \"results\": [\n", run.corpus, run.reps);
+    for (size_t i = 0; i < nres; ++i) write_result(f, &res[i], i + 1 == nres);
+    fprintf(f, "  ]\n}\n");
+    int exit_code = fclose(f) == 0 ? 0 : 1;
+
+    if (baseline_path) {
+        size_t nbase;
+        baseline_t *base = load_baseline(baseline_path, &nbase);
+        if (!base) {
+            exit_code = 1;
+        } else if (compare_baseline(res, nres, base, nbase, threshold) > 0) {
+            exit_code = 3;
+        }
+        free(base);
+    }
+    free(res);
+    free(bindir);
+    return exit_code;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    int rc = 2;
+    if (strcmp(argv[1], "gen") == 0) rc = cmd_gen(argc - 1, argv + 1);
+    else if (strcmp(argv[1], "run") == 0) rc = cmd_run(argc - 1, argv + 1);
+    if (rc == 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    return rc;
+}
@@ -1,34 +1,50 @@
 #include "cat.h"
+#include "../common/input.h"
+#include "../common/stats.h"
+#include <errno.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <string.h>
 
+// cat is often pointed at logs that are rotated or truncated while it
+// runs, so files are read rather than mapped (no SIGBUS).
 static char* read_file(int fd, size_t* size) {
-    char* content = NULL;
+    input_t in;
+    if (input_open(&in, fd, INPUT_NOMAP) != 0) {
+        perror("cat: input");
+        close(fd);
+        return NULL;
+    }
+    // Regular files are sized up front; pipes grow geometrically.
+    size_t cap = in.regular && in.size > 0 ? (size_t)in.size : 8192;
+    char* content = malloc(cap);
     size_t content_size = 0;
-    char buf[8192];
-    for (;;) {
-        ssize_t n = read(fd, buf, sizeof(buf));
-        if (n < 0) {
-            perror("cat: read file");
-            close(fd);
-            return NULL;
-        }
-        if (n == 0) {
-            break; 
+    const unsigned char* data;
+    ssize_t n = 0;
+    if (!content) perror("cat: malloc");
+    while (content && (n = input_next(&in, &data)) > 0) {
+        if (content_size + (size_t)n > cap) {
+            while (content_size + (size_t)n > cap) cap *= 2;
+            char* new_content = realloc(content, cap);
+            if (!new_content) {
+                perror("cat: realloc");
+                free(content);
+                content = NULL;
+                break;
+            }
+            content = new_content;
         }
+        memcpy(content + content_size, data, (size_t)n);
         content_size += (size_t)n;
-        char* new_content = realloc(content, content_size);
-        if (!new_content) {
-            perror("cat: realloc");
-            close(fd);
-            free(content);
-            return NULL;
-        }
-        content = new_content;
-        memcpy(content + content_size - (size_t)n, buf, (size_t)n);
     }
+    if (n < 0) {
+        errno = in.error;
+        perror("cat: read file");
+        free(content);
+        content = NULL;
+    }
+    input_close(&in);
     close(fd);
     *size = content_size;
     return content;
@@ -140,10 +156,12 @@ static void show_nonblank_line_num(char **content_ptr, size_t *content_size){
 
 cat_ret cat(int fd, const cat_options* options){
     size_t content_size = 0;
+    stats_phase("read");
     char* content = read_file(fd, &content_size);
     if (!content) {
         return (cat_ret){NULL, 0};
     }
+    stats_phase("transform");
     if(options->squeeze_blank_lines){
        squeeze_blank_lines(&content, &content_size);
     }
@@ -154,3 +172,38 @@ cat_ret cat(int fd, const cat_options* options){
     }
     return (cat_ret){content, content_size};
 }
+
+int cat_copy(int fd, int out_fd){
+    input_t in;
+    if (input_open(&in, fd, INPUT_NOMAP) != 0) {
+        perror("cat: input");
+        close(fd);
+        return -1;
+    }
+    int ret = 0;
+    const unsigned char* data;
+    ssize_t n;
+    while (ret == 0 && (n = input_next(&in, &data)) > 0) {
+        while (n > 0) {
+            ssize_t w = write(out_fd, data, (size_t)n);
+            stats_add(STATS_SYS_WRITE, 1);
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                perror("cat: write");
+                ret = -1;
+                break;
+            }
+            stats_add(STATS_BYTES_WRITTEN, (uint64_t)w);
+            data += w;
+            n -= w;
+        }
+    }
+    if (ret == 0 && n < 0) {
+        errno = in.error;
+        perror("cat: read file");
+        ret = -1;
+    }
+    input_close(&in);
+    close(fd);
+    return ret;
+}
@@ -14,6 +14,10 @@ typedef struct _cat_ret{
 } cat_ret;
 
 cat_ret cat(int fd, const cat_options* options);
+// Without options: copies fd to out_fd block by block, nothing is buffered whole.
+int cat_copy(int fd, int out_fd);
+// Command-line entry point; main() calls it unless built with UNIXC_MULTICALL.
+int cat_main(int argc, char **argv);
 
 
 #endif
\ No newline at end of file
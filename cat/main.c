@@ -1,13 +1,33 @@
 #include "cat.h"
+#include "../common/stats.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/stat.h>
 
-static int process_fd(int fd, const cat_options *options){
+// A regular file copied onto itself either never ends (>>) or is
+// overwritten before it is read.
+static int is_output(int fd) {
+    struct stat in_st, out_st;
+    return fstat(fd, &in_st) == 0 && fstat(STDOUT_FILENO, &out_st) == 0 && S_ISREG(in_st.st_mode) &&
+           in_st.st_dev == out_st.st_dev && in_st.st_ino == out_st.st_ino;
+}
+
+static int process_fd(int fd, const char *name, const cat_options *options){
+    if (is_output(fd)) {
+        fprintf(stderr, "cat: %s: input file is output file\n", name);
+        if (fd != STDIN_FILENO) close(fd);
+        return 1;
+    }
+    if (!options->show_line_num && !options->number_nonblank_lines && !options->squeeze_blank_lines) {
+        return cat_copy(fd, STDOUT_FILENO) != 0;
+    }
     cat_ret ret = cat(fd, &options[0]);
     if (!ret.content) return 1;
+    stats_phase("write");
     size_t written = fwrite(ret.content, 1, ret.content_size, stdout);
+    stats_add(STATS_BYTES_WRITTEN, written);
     if (written != ret.content_size) {
         perror("cat: write");
         free(ret.content);
@@ -17,7 +37,8 @@ static int process_fd(int fd, const cat_options *options){
     return 0;
 }
 
-int main(int argc, char **argv){
+int cat_main(int argc, char **argv){
+    stats_init("cat", &argc, argv);
     cat_options options = (cat_options){0,0,0};
     char **files = NULL;
     int files_count = 0;
@@ -53,7 +74,7 @@ int main(int argc, char **argv){
     }
 
     if (files_count == 0) {
-        int rc = process_fd(STDIN_FILENO, &options);
+        int rc = process_fd(STDIN_FILENO, "-", &options);
         free(files);
         return rc;
     }
@@ -61,7 +82,7 @@ int main(int argc, char **argv){
     int exit_code = 0;
     for (int i = 0; i < files_count; ++i) {
         if (files[i][0] == '-' && files[i][1] == '\0') {
-            if (process_fd(STDIN_FILENO, &options) != 0) exit_code = 1;
+            if (process_fd(STDIN_FILENO, "-", &options) != 0) exit_code = 1;
             continue;
         }
         int fd = open(files[i], O_RDONLY);
@@ -70,8 +91,14 @@ int main(int argc, char **argv){
             exit_code = 1;
             continue;
         }
-        if (process_fd(fd, &options) != 0) exit_code = 1;
+        if (process_fd(fd, files[i], &options) != 0) exit_code = 1;
     }
     free(files);
     return exit_code;
 }
+
+#ifndef UNIXC_MULTICALL
+int main(int argc, char **argv) {
+    return cat_main(argc, argv);
+}
+#endif
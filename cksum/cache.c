@@ -0,0 +1,244 @@
+#include "cache.h"
+#include "../common/hash.h"
+#include "../common/replace.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CACHE_MAGIC 0x3143484341434b43ull   // "CKCACHC1" read little-endian
+#define CACHE_VERSION 1u
+#define CACHE_MIN_CAPACITY 64u
+#define CACHE_RACY_NS 2000000000ll          // files touched this recently are not cached
+
+typedef struct cache_header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t slot_size;
+    uint64_t capacity;  // power of two
+    uint64_t count;
+    uint64_t reserved[4];
+} cache_header_t;
+
+typedef struct cache_slot {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t size;
+    int64_t mtime_ns;
+    int64_t ctime_ns;
+    uint32_t crc;
+    uint32_t algo;
+    uint64_t check;     // hash of the fields above, 0 marks an empty slot
+} cache_slot_t;
+
+struct cksum_cache {
+    char *path;
+    void *map;
+    size_t map_size;
+    const cache_slot_t *slots;  // read-only view of the file, NULL if empty
+    unsigned char *seen;        // per slot, set by lookups that hit
+    uint64_t capacity;
+    uint64_t count;
+    cache_slot_t *pending;      // entries computed during this run
+    size_t npending;
+    size_t pending_cap;
+    pthread_mutex_t mu;
+};
+
+static inline uint64_t slot_hash(uint64_t dev, uint64_t ino, uint32_t algo) {
+    return hash_inode(dev, ino ^ ((uint64_t)algo << 56));
+}
+
+static uint64_t slot_check(const cache_slot_t *s) {
+    uint64_t h = slot_hash(s->dev, s->ino, s->algo);
+    h = hash_fold(h, s->size);
+    h = hash_fold(h, (uint64_t)s->mtime_ns);
+    h = hash_fold(h, (uint64_t)s->ctime_ns);
+    h = hash_fold(h, s->crc);
+    return h | 1u;
+}
+
+static inline int64_t ts_ns(const struct timespec *ts) {
+    return (int64_t)ts->tv_sec * 1000000000ll + ts->tv_nsec;
+}
+
+static void fill_key(cache_slot_t *s, const struct stat *st, cksum_algo_t algo) {
+    memset(s, 0, sizeof(*s));
+    s->dev = (uint64_t)st->st_dev;
+    s->ino = (uint64_t)st->st_ino;
+    s->size = (uint64_t)st->st_size;
+    s->mtime_ns = ts_ns(&st->st_mtim);
+    s->ctime_ns = ts_ns(&st->st_ctim);
+    s->algo = (uint32_t)algo;
+}
+
+static int load_map(cksum_cache_t *c) {
+    int fd = open(c->path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(cache_header_t)) {
+        close(fd);
+        return -1;
+    }
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return -1;
+    const cache_header_t *h = (const cache_header_t *)map;
+    int ok = h->magic == CACHE_MAGIC && h->version == CACHE_VERSION &&
+             h->slot_size == sizeof(cache_slot_t) &&
+             h->capacity != 0 && (h->capacity & (h->capacity - 1)) == 0 &&
+             h->capacity <= ((uint64_t)st.st_size - sizeof(cache_header_t)) / sizeof(cache_slot_t) &&
+             (uint64_t)st.st_size == sizeof(cache_header_t) + h->capacity * sizeof(cache_slot_t);
+    if (!ok) {
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+    c->map = map;
+    c->map_size = (size_t)st.st_size;
+    c->slots = (const cache_slot_t *)((const char *)map + sizeof(cache_header_t));
+    c->capacity = h->capacity;
+    c->count = h->count;
+    return 0;
+}
+
+cksum_cache_t *cksum_cache_open(const char *path) {
+    cksum_cache_t *c = (cksum_cache_t *)calloc(1, sizeof(cksum_cache_t));
+    if (!c) return NULL;
+    c->path = strdup(path);
+    if (!c->path) {
+        free(c);
+        return NULL;
+    }
+    load_map(c); // a missing or corrupt cache is simply rebuilt
+    if (c->slots) {
+        c->seen = (unsigned char *)calloc((size_t)c->capacity, 1);
+        if (!c->seen) {
+            munmap(c->map, c->map_size);
+            free(c->path);
+            free(c);
+            return NULL;
+        }
+    }
+    pthread_mutex_init(&c->mu, NULL);
+    return c;
+}
+
+int cksum_cache_lookup(cksum_cache_t *c, const struct stat *st, cksum_algo_t algo, uint32_t *crc) {
+    if (!c || !c->slots) return -1;
+    cache_slot_t key;
+    fill_key(&key, st, algo);
+    uint64_t mask = c->capacity - 1;
+    uint64_t i = slot_hash(key.dev, key.ino, key.algo) & mask;
+    for (uint64_t probes = 0; probes < c->capacity; ++probes, i = (i + 1) & mask) {
+        const cache_slot_t *s = &c->slots[i];
+        if (s->check == 0) return -1;
+        if (s->dev != key.dev || s->ino != key.ino || s->algo != key.algo) continue;
+        if (s->check != slot_check(s)) return -1;
+        if (s->size != key.size || s->mtime_ns != key.mtime_ns || s->ctime_ns != key.ctime_ns) return -1;
+        __atomic_store_n(&c->seen[i], 1, __ATOMIC_RELAXED);
+        *crc = s->crc;
+        return 0;
+    }
+    return -1;
+}
+
+void cksum_cache_insert(cksum_cache_t *c, const struct stat *before, const struct stat *after, cksum_algo_t algo, uint32_t crc) {
+    if (!c) return;
+    cache_slot_t e, e2;
+    fill_key(&e, before, algo);
+    fill_key(&e2, after, algo);
+    if (memcmp(&e, &e2, sizeof(e)) != 0) return; // changed while we read it
+    // A write landing in the same timestamp tick as our read would leave the
+    // metadata unchanged, so recently modified files are left uncached.
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    int64_t newest = e.mtime_ns > e.ctime_ns ? e.mtime_ns : e.ctime_ns;
+    if (ts_ns(&now) - newest < CACHE_RACY_NS) return;
+    e.crc = crc;
+    e.check = slot_check(&e);
+
+    pthread_mutex_lock(&c->mu);
+    if (c->npending == c->pending_cap) {
+        size_t cap = c->pending_cap ? c->pending_cap * 2 : 256;
+        cache_slot_t *p = (cache_slot_t *)realloc(c->pending, cap * sizeof(cache_slot_t));
+        if (!p) {
+            pthread_mutex_unlock(&c->mu);
+            return;
+        }
+        c->pending = p;
+        c->pending_cap = cap;
+    }
+    c->pending[c->npending++] = e;
+    pthread_mutex_unlock(&c->mu);
+}
+
+// Returns 1 if the slot was newly occupied.
+static int table_put(cache_slot_t *slots, uint64_t capacity, const cache_slot_t *e, int overwrite) {
+    uint64_t mask = capacity - 1;
+    uint64_t i = slot_hash(e->dev, e->ino, e->algo) & mask;
+    for (;;) {
+        cache_slot_t *s = &slots[i];
+        if (s->check == 0) {
+            *s = *e;
+            return 1;
+        }
+        if (s->dev == e->dev && s->ino == e->ino && s->algo == e->algo) {
+            if (overwrite) *s = *e;
+            return 0;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+typedef struct cache_out {
+    const cksum_cache_t *c;
+    uint64_t capacity;
+} cache_out_t;
+
+static void fill_table(void *map, void *ctx) {
+    const cache_out_t *o = (const cache_out_t *)ctx;
+    const cksum_cache_t *c = o->c;
+    cache_header_t *h = (cache_header_t *)map;
+    cache_slot_t *slots = (cache_slot_t *)((char *)map + sizeof(cache_header_t));
+    uint64_t count = 0;
+    // Fresh results first so they replace stale entries for the same inode.
+    for (size_t i = 0; i < c->npending; ++i) count += (uint64_t)table_put(slots, o->capacity, &c->pending[i], 1);
+    for (uint64_t i = 0; c->slots && i < c->capacity; ++i) {
+        const cache_slot_t *s = &c->slots[i];
+        if (!c->seen[i] || s->check != slot_check(s)) continue;
+        count += (uint64_t)table_put(slots, o->capacity, s, 0);
+    }
+    h->magic = CACHE_MAGIC;
+    h->version = CACHE_VERSION;
+    h->slot_size = sizeof(cache_slot_t);
+    h->capacity = o->capacity;
+    h->count = count;
+}
+
+// Keeps this run's results and the old entries it hit; everything else is
+// dropped, so the cache tracks the files cksum is run on instead of growing.
+static int write_back(cksum_cache_t *c) {
+    uint64_t kept = 0;
+    for (uint64_t i = 0; c->slots && i < c->capacity; ++i) kept += c->seen[i];
+    uint64_t want = (kept + (uint64_t)c->npending) * 2;
+    cache_out_t o = { c, CACHE_MIN_CAPACITY };
+    while (o.capacity < want) o.capacity <<= 1;
+    size_t size = sizeof(cache_header_t) + (size_t)o.capacity * sizeof(cache_slot_t);
+    return replace_mapped(c->path, size, fill_table, &o, "cksum: cache");
+}
+
+int cksum_cache_close(cksum_cache_t *c) {
+    if (!c) return 0;
+    int ret = 0;
+    if (c->npending > 0) ret = write_back(c);
+    if (c->map) munmap(c->map, c->map_size);
+    pthread_mutex_destroy(&c->mu);
+    free(c->seen);
+    free(c->pending);
+    free(c->path);
+    free(c);
+    return ret;
+}
@@ -0,0 +1,21 @@
+#ifndef CKSUM_CACHE_H
+#define CKSUM_CACHE_H
+#include <stdint.h>
+#include <sys/stat.h>
+#include "cksum.h"
+
+// On-disk checksum cache keyed on (st_dev, st_ino, size, mtime_ns, ctime_ns).
+// Lookups read a read-only mapping of the file and are safe from any thread;
+// new entries are kept in memory and written back by cksum_cache_close via a
+// temporary file and rename, so a crash leaves the previous cache intact.
+// Old entries that no lookup hit during the run are not written back.
+typedef struct cksum_cache cksum_cache_t;
+
+// A missing or unreadable cache file yields an empty cache; NULL only on ENOMEM.
+cksum_cache_t *cksum_cache_open(const char *path);
+int cksum_cache_lookup(cksum_cache_t *cache, const struct stat *st, cksum_algo_t algo, uint32_t *crc);
+// before/after are the file's metadata around the read; nothing is stored if they differ.
+void cksum_cache_insert(cksum_cache_t *cache, const struct stat *before, const struct stat *after, cksum_algo_t algo, uint32_t crc);
+int cksum_cache_close(cksum_cache_t *cache);
+
+#endif
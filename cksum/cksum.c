@@ -1,24 +1,38 @@
 #include "cksum.h"
+#include "cache.h"
+#include "../common/input.h"
+#include "../common/stats.h"
+#include "../wc/wc.h"
+#include "crc_tables.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
-static uint32_t crc32_table[256];
-void init_crc32_table() {
-    uint32_t poly = 0x04C11DB7u; 
-    for (uint32_t i = 0; i < 256; ++i) {
-        uint32_t crc = i << 24;
-        for (int j = 0; j < 8; ++j) {
-            if (crc & 0x80000000u) {
-                crc = (crc << 1) ^ poly;
-            } else {
-                crc <<= 1;
-            }
-        }
-        crc32_table[i] = crc;
-    }
-}
+#include <errno.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#define CKSUM_PARALLEL_MIN (16ull << 20) // regular files below this are read serially
+#define CKSUM_MIN_CHUNK (4ull << 20)     // smallest range handed to one thread
+#define CKSUM_PREAD_BLOCK (1u << 20)
+#define CKSUM_LANE 4096u                 // bytes per lane in the three-way interleaved loops
+#define CKSUM_FUSE_TILE (64u << 10)      // --count: CRC then count each tile while it is in L2
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define CKSUM_HAVE_CRC32C_HW 1
+#endif
+#if CRC_TABLES_LANE != CKSUM_LANE
+#error "cksum/crc_tables.h is stale, regenerate it with cksum/gen/crc_gen.c"
+#endif
+// Reflected (LSB-first) CRC with init and xorout of all ones: crc32b and crc32c.
+typedef struct crc_reflected {
+    uint32_t poly;
+    const uint32_t *table;
+    const uint32_t (*lane_shift)[4][256]; // multiply by x^(8*LANE) and x^(16*LANE), one table per byte
+} crc_reflected_t;
+static const crc_reflected_t crc32b_desc = { 0xEDB88320u, crc32b_table, crc32b_lane_shift };
+static const crc_reflected_t crc32c_desc = { 0x82F63B78u, crc32c_table, crc32c_lane_shift };
 uint32_t update_crc(uint32_t crc, unsigned char *buf, int len) {
     for (int i = 0; i < len; ++i) {
         uint32_t idx = ((crc >> 24) ^ buf[i]) & 0xFFu;
@@ -26,30 +40,664 @@ uint32_t update_crc(uint32_t crc, unsigned char *buf, int len) {
     }
     return crc;
 }
-int cksum_stream(int fd, const char *name) {
-    unsigned char buf[8192];
-    uint32_t crc = 0u; 
-    unsigned long long total = 0ull;
-    for (;;) {
-        ssize_t n = read(fd, buf, sizeof(buf));
-        if (n < 0) {
-            perror("cksum: read error");
-            return -1;
-        }
-        if (n == 0) {
-            break; // EOF
-        }
-        crc = update_crc(crc, buf, (int)n);
-        total += (unsigned long long)n;
+static uint32_t crc_mulx(uint32_t a) {
+    return (a & 0x80000000u) ? (a << 1) ^ 0x04C11DB7u : a << 1;
+}
+// a * b mod P over GF(2), bit i holding the coefficient of x^i
+static uint32_t crc_multmodp(uint32_t a, uint32_t b) {
+    uint32_t p = 0u;
+    for (int i = 31; i >= 0; --i) {
+        p = crc_mulx(p);
+        if ((a >> i) & 1u) p ^= b;
     }
+    return p;
+}
+// x^(8 * len) mod P, i.e. the effect of feeding len zero bytes
+static uint32_t crc_x8nmodp(unsigned long long len) {
+    uint32_t p = 1u;
+    uint32_t sq = 0x100u;
+    while (len != 0ull) {
+        if (len & 1ull) p = crc_multmodp(p, sq);
+        sq = crc_multmodp(sq, sq);
+        len >>= 1;
+    }
+    return p;
+}
+uint32_t crc_combine(uint32_t crc_a, uint32_t crc_b, unsigned long long len_b) {
+    return crc_multmodp(crc_a, crc_x8nmodp(len_b)) ^ crc_b;
+}
+static uint32_t crc_finish(uint32_t crc, unsigned long long total) {
     unsigned long long len_bytes = total;
     while (len_bytes != 0ull) {
         unsigned char b = (unsigned char)(len_bytes & 0xFFu);
         crc = update_crc(crc, &b, 1);
         len_bytes >>= 8;
     }
-    crc ^= 0xFFFFFFFFu;
-    if (name)  printf("%u %llu %s\n", crc, total, name);
-    else printf("%u %llu\n", crc, total);
+    return crc ^ 0xFFFFFFFFu;
+}
+// Same as crc_multmodp in the reflected domain, where bit 31 is x^0.
+static uint32_t crc_r_multmodp(uint32_t poly, uint32_t a, uint32_t b) {
+    uint32_t p = 0u;
+    for (int i = 0; i < 32; ++i) {
+        if (a & (0x80000000u >> i)) p ^= b;
+        b = (b & 1u) ? (b >> 1) ^ poly : b >> 1;
+    }
+    return p;
+}
+static uint32_t crc_r_x8nmodp(uint32_t poly, unsigned long long len) {
+    uint32_t p = 0x80000000u;
+    uint32_t sq = 0x00800000u;
+    while (len != 0ull) {
+        if (len & 1ull) p = crc_r_multmodp(poly, p, sq);
+        sq = crc_r_multmodp(poly, sq, sq);
+        len >>= 1;
+    }
+    return p;
+}
+// Multiplication by a fixed power of x is linear, so it splits into one lookup per byte.
+static inline uint32_t crc_r_shift(const uint32_t t[4][256], uint32_t a) {
+    return t[0][a & 0xFFu] ^ t[1][(a >> 8) & 0xFFu] ^ t[2][(a >> 16) & 0xFFu] ^ t[3][a >> 24];
+}
+static uint32_t crc_r_bytes(const uint32_t *table, uint32_t reg, const unsigned char *p, size_t len) {
+    for (size_t i = 0; i < len; ++i) reg = (reg >> 8) ^ table[(reg ^ p[i]) & 0xFFu];
+    return reg;
+}
+// Three independent lanes hide the table-lookup latency; the lanes are folded
+// back together with the precomputed shift tables after every 3*LANE bytes.
+static uint32_t crc_r_update_sw(const crc_reflected_t *d, uint32_t reg, const unsigned char *p, size_t len) {
+    while (len >= 3 * CKSUM_LANE) {
+        uint32_t a = reg, b = 0u, c = 0u;
+        const unsigned char *pb = p + CKSUM_LANE;
+        const unsigned char *pc = p + 2 * CKSUM_LANE;
+        for (size_t i = 0; i < CKSUM_LANE; ++i) {
+            a = (a >> 8) ^ d->table[(a ^ p[i]) & 0xFFu];
+            b = (b >> 8) ^ d->table[(b ^ pb[i]) & 0xFFu];
+            c = (c >> 8) ^ d->table[(c ^ pc[i]) & 0xFFu];
+        }
+        reg = crc_r_shift(d->lane_shift[1], a) ^ crc_r_shift(d->lane_shift[0], b) ^ c;
+        p += 3 * CKSUM_LANE;
+        len -= 3 * CKSUM_LANE;
+    }
+    return crc_r_bytes(d->table, reg, p, len);
+}
+#ifdef CKSUM_HAVE_CRC32C_HW
+// The crc32 instruction has 3-cycle latency and 1-cycle throughput, so three
+// lanes keep the unit busy.
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_update_hw(const crc_reflected_t *d, uint32_t reg, const unsigned char *p, size_t len) {
+    while (len >= 3 * CKSUM_LANE) {
+        uint64_t a = reg, b = 0u, c = 0u;
+        for (size_t i = 0; i < CKSUM_LANE; i += 8) {
+            uint64_t wa, wb, wc;
+            memcpy(&wa, p + i, 8);
+            memcpy(&wb, p + CKSUM_LANE + i, 8);
+            memcpy(&wc, p + 2 * CKSUM_LANE + i, 8);
+            a = _mm_crc32_u64(a, wa);
+            b = _mm_crc32_u64(b, wb);
+            c = _mm_crc32_u64(c, wc);
+        }
+        reg = crc_r_shift(d->lane_shift[1], (uint32_t)a) ^ crc_r_shift(d->lane_shift[0], (uint32_t)b) ^ (uint32_t)c;
+        p += 3 * CKSUM_LANE;
+        len -= 3 * CKSUM_LANE;
+    }
+    while (len >= 8) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        reg = (uint32_t)_mm_crc32_u64(reg, w);
+        p += 8;
+        len -= 8;
+    }
+    while (len-- > 0) reg = _mm_crc32_u8(reg, *p++);
+    return reg;
+}
+#endif
+static uint32_t algo_init_reg(cksum_algo_t algo) {
+    return algo == CKSUM_ALGO_CRC ? 0u : 0xFFFFFFFFu;
+}
+// Raw register update, no length suffix and no final inversion.
+static uint32_t algo_update(cksum_algo_t algo, uint32_t reg, const unsigned char *p, size_t len) {
+    switch (algo) {
+        case CKSUM_ALGO_CRC32B:
+            return crc_r_update_sw(&crc32b_desc, reg, p, len);
+        case CKSUM_ALGO_CRC32C:
+#ifdef CKSUM_HAVE_CRC32C_HW
+            if (__builtin_cpu_supports("sse4.2")) return crc32c_update_hw(&crc32c_desc, reg, p, len);
+#endif
+            return crc_r_update_sw(&crc32c_desc, reg, p, len);
+        case CKSUM_ALGO_CRC:
+        default:
+            while (len > 0) {
+                int n = len > (1u << 30) ? (1 << 30) : (int)len;
+                reg = update_crc(reg, (unsigned char *)p, n);
+                p += n;
+                len -= (size_t)n;
+            }
+            return reg;
+    }
+}
+// reg_b must have been computed from a zero register.
+static uint32_t algo_combine(cksum_algo_t algo, uint32_t reg_a, uint32_t reg_b, unsigned long long len_b) {
+    if (algo == CKSUM_ALGO_CRC) return crc_combine(reg_a, reg_b, len_b);
+    uint32_t poly = algo == CKSUM_ALGO_CRC32C ? crc32c_desc.poly : crc32b_desc.poly;
+    return crc_r_multmodp(poly, reg_a, crc_r_x8nmodp(poly, len_b)) ^ reg_b;
+}
+static uint32_t algo_final(cksum_algo_t algo, uint32_t reg, unsigned long long total) {
+    if (algo == CKSUM_ALGO_CRC) return crc_finish(reg, total);
+    return reg ^ 0xFFFFFFFFu;
+}
+static const char *const algo_names[] = { "crc", "crc32b", "crc32c" };
+int cksum_algo_from_name(const char *name, cksum_algo_t *out) {
+    for (int i = 0; i < (int)(sizeof(algo_names) / sizeof(algo_names[0])); ++i) {
+        if (strcmp(name, algo_names[i]) == 0) {
+            *out = (cksum_algo_t)i;
+            return 0;
+        }
+    }
+    return -1;
+}
+const char *cksum_algo_name(cksum_algo_t algo) {
+    return algo_names[algo];
+}
+void cksum_hasher_init(cksum_hasher_t *h, cksum_algo_t algo) {
+    h->algo = algo;
+    h->reg = algo_init_reg(algo);
+    h->total = 0ull;
+}
+void cksum_hasher_update(cksum_hasher_t *h, const void *buf, size_t len) {
+    h->reg = algo_update(h->algo, h->reg, (const unsigned char *)buf, len);
+    h->total += (unsigned long long)len;
+}
+uint32_t cksum_hasher_final(const cksum_hasher_t *h) {
+    return algo_final(h->algo, h->reg, h->total);
+}
+typedef struct crc_chunk_args {
+    int fd;
+    cksum_algo_t algo;
+    off_t begin;
+    off_t end; // exclusive
+    uint32_t crc;
+    int error;
+} crc_chunk_args_t;
+static void *crc_chunk(void *argp) {
+    crc_chunk_args_t *arg = (crc_chunk_args_t *)argp;
+    arg->crc = 0u;
+    arg->error = 0;
+    unsigned char *buf = (unsigned char *)malloc(CKSUM_PREAD_BLOCK);
+    if (!buf) {
+        arg->error = ENOMEM;
+        return NULL;
+    }
+    off_t off = arg->begin;
+    double t0 = stats_now();
+    while (off < arg->end) {
+        size_t want = CKSUM_PREAD_BLOCK;
+        if ((off_t)want > arg->end - off) want = (size_t)(arg->end - off);
+        ssize_t n = pread(arg->fd, buf, want, off);
+        stats_add(STATS_SYS_PREAD, 1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            arg->error = errno;
+            break;
+        }
+        if (n == 0) {
+            arg->error = EIO; // file shrank under us
+            break;
+        }
+        stats_add(STATS_BYTES_READ, (uint64_t)n);
+        arg->crc = algo_update(arg->algo, arg->crc, buf, (size_t)n);
+        off += n;
+    }
+    if (stats_enabled) stats_chunk("cksum", stats_now() - t0, (uint64_t)(off - arg->begin));
+    free(buf);
+    return NULL;
+}
+// Splits [begin, end) across threads and merges the chunk CRCs in order.
+// Returns -1 without printing anything so the caller can fall back to read().
+static int cksum_parallel(int fd, cksum_algo_t algo, off_t begin, off_t end, size_t max_threads, uint32_t *reg_out) {
+    unsigned long long size = (unsigned long long)(end - begin);
+    size_t nthreads = max_threads;
+    size_t max_threads_by_size = (size_t)((size + CKSUM_MIN_CHUNK - 1) / CKSUM_MIN_CHUNK);
+    if (nthreads > max_threads_by_size) nthreads = max_threads_by_size;
+    if (nthreads < 2) return -1;
+
+    pthread_t *ths = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    crc_chunk_args_t *args = (crc_chunk_args_t *)malloc(nthreads * sizeof(crc_chunk_args_t));
+    if (!ths || !args) {
+        free(ths); free(args);
+        return -1;
+    }
+    unsigned long long chunk = size / nthreads;
+    unsigned long long rem = size % nthreads;
+    off_t base = begin;
+    size_t started = 0;
+    for (size_t i = 0; i < nthreads; ++i) {
+        args[i].fd = fd;
+        args[i].algo = algo;
+        args[i].begin = base;
+        args[i].end = base + (off_t)(chunk + (i < rem ? 1 : 0));
+        base = args[i].end;
+        if (pthread_create(&ths[i], NULL, crc_chunk, &args[i]) != 0) break;
+        started++;
+    }
+    for (size_t i = 0; i < started; ++i) pthread_join(ths[i], NULL);
+
+    int ret = 0;
+    uint32_t reg = algo_init_reg(algo);
+    if (started != nthreads) ret = -1;
+    for (size_t i = 0; ret == 0 && i < nthreads; ++i) {
+        if (args[i].error != 0) {
+            ret = -1;
+            break;
+        }
+        reg = algo_combine(algo, reg, args[i].crc, (unsigned long long)(args[i].end - args[i].begin));
+    }
+    free(ths); free(args);
+    if (ret == 0) *reg_out = reg;
+    return ret;
+}
+// sysconf reads /sys on every call, so the answer is kept.
+static size_t online_cpus(void) {
+    static size_t cached;
+    size_t cpus = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+    if (cpus == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        cpus = n < 1 ? 1 : (size_t)n;
+        __atomic_store_n(&cached, cpus, __ATOMIC_RELAXED);
+    }
+    return cpus;
+}
+// Returns 0 or the errno of the failed read. With count, each block is
+// walked in tiles so the counter rereads what the CRC just pulled in.
+static int input_loop(int fd, cksum_hasher_t *h, wc_state_t *count) {
+    input_t in;
+    if (input_open(&in, fd, INPUT_AUTO) != 0) return errno;
+    const unsigned char *data;
+    ssize_t n;
+    while ((n = input_next(&in, &data)) > 0) {
+        if (!count) {
+            cksum_hasher_update(h, data, (size_t)n);
+            continue;
+        }
+        for (size_t off = 0; off < (size_t)n; off += CKSUM_FUSE_TILE) {
+            size_t len = (size_t)n - off;
+            if (len > CKSUM_FUSE_TILE) len = CKSUM_FUSE_TILE;
+            cksum_hasher_update(h, data + off, len);
+            wc_count(count, data + off, len);
+        }
+    }
+    int ret = n < 0 ? in.error : 0;
+    input_close(&in);
+    return ret;
+}
+int cksum_fd(int fd, cksum_algo_t algo, size_t max_threads, cksum_result_t *out) {
+    cksum_hasher_t h;
+    cksum_hasher_init(&h, algo);
+    struct stat st;
+    int done = 0;
+    out->error = 0;
+    if (max_threads == 0) max_threads = online_cpus();
+    int regular = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+    off_t begin = regular ? lseek(fd, 0, SEEK_CUR) : -1;
+    if (max_threads > 1 && regular && (unsigned long long)st.st_size >= CKSUM_PARALLEL_MIN) {
+        if (begin >= 0 && begin < st.st_size && cksum_parallel(fd, algo, begin, st.st_size, max_threads, &h.reg) == 0) {
+            h.total = (unsigned long long)(st.st_size - begin);
+            lseek(fd, st.st_size, SEEK_SET);
+            stats_engine("cksum", "parallel");
+            done = 1;
+        } else if (begin >= 0) {
+            lseek(fd, begin, SEEK_SET);
+        }
+    }
+    if (!done) {
+        stats_engine("cksum", "sequential");
+        int ret = input_loop(fd, &h, NULL);
+        if (ret != 0) {
+            out->error = ret;
+            return -1;
+        }
+    }
+    out->crc = cksum_hasher_final(&h);
+    out->total = h.total;
+    return 0;
+}
+int cksum_fd_count(int fd, cksum_algo_t algo, cksum_result_t *out) {
+    cksum_hasher_t h;
+    cksum_hasher_init(&h, algo);
+    wc_state_t count;
+    memset(&count, 0, sizeof(count));
+    stats_engine("cksum", "fused_count");
+    out->error = input_loop(fd, &h, &count);
+    if (out->error != 0) return -1;
+    out->crc = cksum_hasher_final(&h);
+    out->total = h.total;
+    out->lines = count.lines;
+    out->words = count.words;
+    return 0;
+}
+int cksum_stream(int fd, const char *name) {
+    cksum_result_t r;
+    if (cksum_fd(fd, CKSUM_ALGO_CRC, 0, &r) != 0) {
+        errno = r.error;
+        perror("cksum: read error");
+        return -1;
+    }
+    if (name)  printf("%u %llu %s\n", r.crc, r.total, name);
+    else printf("%u %llu\n", r.crc, r.total);
     return 0;
 }
+typedef struct cksum_pool {
+    const char *const *paths;
+    size_t n;
+    size_t next;            // next argument to claim
+    size_t emitted;         // arguments already handed to emit, in order
+    size_t window;          // reorder buffer slots
+    const cksum_options_t *opt;
+    size_t file_threads;    // thread budget for a single file
+    cksum_result_t *slots;  // slot i % window holds argument i
+    unsigned char *ready;
+    pthread_mutex_t mu;
+    pthread_cond_t worker_cv;
+    pthread_cond_t emit_cv;
+} cksum_pool_t;
+// expect_size >= 0 skips reading a regular file whose size already disagrees;
+// out->total then carries the actual size so the caller sees the mismatch.
+static void cksum_path(const char *path, const cksum_options_t *opt, size_t max_threads, long long expect_size, cksum_result_t *out) {
+    int fd = open(path, O_RDONLY);
+    stats_add(STATS_SYS_OPEN, 1);
+    if (fd < 0) {
+        out->error = errno;
+        return;
+    }
+    struct stat before;
+    int regular = (opt->cache || expect_size >= 0) && fstat(fd, &before) == 0 && S_ISREG(before.st_mode);
+    if (regular && expect_size >= 0 && (long long)before.st_size != expect_size) {
+        out->crc = 0u;
+        out->total = (unsigned long long)before.st_size;
+        out->error = 0;
+        close(fd);
+        return;
+    }
+    if (opt->count) {
+        cksum_fd_count(fd, opt->algo, out);
+        close(fd);
+        return;
+    }
+    int cacheable = regular && opt->cache;
+    if (cacheable && cksum_cache_lookup(opt->cache, &before, opt->algo, &out->crc) == 0) {
+        stats_engine("cache", "hit");
+        out->total = (unsigned long long)before.st_size;
+        out->error = 0;
+        close(fd);
+        return;
+    }
+    if (cksum_fd(fd, opt->algo, max_threads, out) == 0 && cacheable) {
+        struct stat after;
+        if (fstat(fd, &after) == 0 && out->total == (unsigned long long)before.st_size) {
+            cksum_cache_insert(opt->cache, &before, &after, opt->algo, out->crc);
+        }
+    }
+    close(fd);
+}
+static size_t resolve_workers(const cksum_options_t *opt) {
+    // oversubscribe to overlap open/read latency
+    return opt->workers ? opt->workers : online_cpus() * 2;
+}
+static void *cksum_pool_worker(void *argp) {
+    cksum_pool_t *pool = (cksum_pool_t *)argp;
+    pthread_mutex_lock(&pool->mu);
+    for (;;) {
+        while (pool->next < pool->n && pool->next >= pool->emitted + pool->window) {
+            pthread_cond_wait(&pool->worker_cv, &pool->mu);
+        }
+        if (pool->next >= pool->n) break;
+        size_t idx = pool->next++;
+        pthread_mutex_unlock(&pool->mu);
+
+        cksum_result_t r;
+        cksum_path(pool->paths[idx], pool->opt, pool->file_threads, -1, &r);
+
+        pthread_mutex_lock(&pool->mu);
+        pool->slots[idx % pool->window] = r;
+        pool->ready[idx % pool->window] = 1;
+        if (idx == pool->emitted) pthread_cond_signal(&pool->emit_cv);
+    }
+    pthread_mutex_unlock(&pool->mu);
+    return NULL;
+}
+int cksum_paths(const char *const *paths, size_t n, const cksum_options_t *opt, cksum_emit_fn emit, void *ctx) {
+    if (n == 0) return 0;
+    size_t workers = resolve_workers(opt);
+    if (workers > n) workers = n;
+
+    cksum_pool_t pool;
+    pool.paths = paths;
+    pool.n = n;
+    pool.next = 0;
+    pool.emitted = 0;
+    pool.window = workers * 16;
+    pool.opt = opt;
+    pool.file_threads = workers == 1 ? 0 : 1;
+    pool.slots = (cksum_result_t *)malloc(pool.window * sizeof(cksum_result_t));
+    pool.ready = (unsigned char *)calloc(pool.window, 1);
+    pthread_t *ths = (pthread_t *)malloc(workers * sizeof(pthread_t));
+    if (!pool.slots || !pool.ready || !ths) {
+        perror("cksum: malloc");
+        free(pool.slots); free(pool.ready); free(ths);
+        return -1;
+    }
+    pthread_mutex_init(&pool.mu, NULL);
+    pthread_cond_init(&pool.worker_cv, NULL);
+    pthread_cond_init(&pool.emit_cv, NULL);
+
+    // A single worker would only hand results back, so it runs inline.
+    size_t started = 0;
+    for (; workers > 1 && started < workers; ++started) {
+        if (pthread_create(&ths[started], NULL, cksum_pool_worker, &pool) != 0) break;
+    }
+    if (started == 0) {
+        // no threads at all: run the same loop on the calling thread
+        for (size_t i = 0; i < n; ++i) {
+            cksum_result_t r;
+            cksum_path(paths[i], opt, 0, -1, &r);
+            emit(paths[i], &r, ctx);
+        }
+    } else {
+        pthread_mutex_lock(&pool.mu);
+        while (pool.emitted < n) {
+            size_t slot = pool.emitted % pool.window;
+            while (!pool.ready[slot]) pthread_cond_wait(&pool.emit_cv, &pool.mu);
+            cksum_result_t r = pool.slots[slot];
+            pool.ready[slot] = 0;
+            pthread_mutex_unlock(&pool.mu);
+            emit(paths[pool.emitted], &r, ctx);
+            pthread_mutex_lock(&pool.mu);
+            pool.emitted++;
+            pthread_cond_broadcast(&pool.worker_cv);
+        }
+        pthread_mutex_unlock(&pool.mu);
+        for (size_t i = 0; i < started; ++i) pthread_join(ths[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool.emit_cv);
+    pthread_cond_destroy(&pool.worker_cv);
+    pthread_mutex_destroy(&pool.mu);
+    free(pool.slots); free(pool.ready); free(ths);
+    return 0;
+}
+typedef struct check_item {
+    char *path;
+    uint32_t crc;
+    unsigned long long size;
+} check_item_t;
+// Manifest entries wait in a bounded max-heap on size, so within the
+// look-ahead window the biggest files are started first.
+typedef struct check_queue {
+    check_item_t *heap;
+    size_t len;
+    size_t cap;
+    int eof;
+    const cksum_options_t *opt;
+    size_t file_threads;
+    cksum_check_fn report;
+    void *ctx;
+    cksum_check_summary_t *sum;
+    pthread_mutex_t mu;
+    pthread_mutex_t report_mu;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+} check_queue_t;
+static void heap_push(check_queue_t *q, check_item_t item) {
+    size_t i = q->len++;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (q->heap[parent].size >= item.size) break;
+        q->heap[i] = q->heap[parent];
+        i = parent;
+    }
+    q->heap[i] = item;
+}
+static check_item_t heap_pop(check_queue_t *q) {
+    check_item_t top = q->heap[0];
+    check_item_t last = q->heap[--q->len];
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= q->len) break;
+        if (child + 1 < q->len && q->heap[child + 1].size > q->heap[child].size) child++;
+        if (last.size >= q->heap[child].size) break;
+        q->heap[i] = q->heap[child];
+        i = child;
+    }
+    if (q->len > 0) q->heap[i] = last;
+    return top;
+}
+// "CRC SIZE NAME", as printed by cksum; NAME runs to the end of the line.
+static int parse_manifest_line(char *line, check_item_t *out) {
+    size_t len = strlen(line);
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) line[--len] = '\0';
+    char *end;
+    errno = 0;
+    unsigned long crc = strtoul(line, &end, 10);
+    if (errno != 0 || end == line || *end != ' ' || crc > 0xFFFFFFFFul) return -1;
+    char *p = end + 1;
+    unsigned long long size = strtoull(p, &end, 10);
+    if (errno != 0 || end == p || *end != ' ' || end[1] == '\0') return -1;
+    out->path = strdup(end + 1);
+    if (!out->path) return -1;
+    out->crc = (uint32_t)crc;
+    out->size = size;
+    return 0;
+}
+static void check_one(check_queue_t *q, check_item_t item) {
+    cksum_result_t r;
+    cksum_path(item.path, q->opt, q->file_threads, (long long)item.size, &r);
+    cksum_check_status_t status = CKSUM_CHECK_OK;
+    if (r.error != 0) status = CKSUM_CHECK_UNREADABLE;
+    else if (r.crc != item.crc || r.total != item.size) status = CKSUM_CHECK_FAILED;
+
+    pthread_mutex_lock(&q->report_mu);
+    if (status == CKSUM_CHECK_OK) q->sum->ok++;
+    else if (status == CKSUM_CHECK_FAILED) q->sum->failed++;
+    else q->sum->unreadable++;
+    q->report(item.path, status, &r, q->ctx);
+    pthread_mutex_unlock(&q->report_mu);
+    free(item.path);
+}
+static void *check_worker(void *argp) {
+    check_queue_t *q = (check_queue_t *)argp;
+    for (;;) {
+        pthread_mutex_lock(&q->mu);
+        while (q->len == 0 && !q->eof) pthread_cond_wait(&q->not_empty, &q->mu);
+        if (q->len == 0) {
+            pthread_mutex_unlock(&q->mu);
+            break;
+        }
+        check_item_t item = heap_pop(q);
+        pthread_cond_signal(&q->not_full);
+        pthread_mutex_unlock(&q->mu);
+        check_one(q, item);
+    }
+    return NULL;
+}
+// Without any worker thread the caller empties the window itself.
+static void check_drain(check_queue_t *q) {
+    while (q->len > 0) check_one(q, heap_pop(q));
+}
+int cksum_check(FILE *manifest, const cksum_options_t *opt, cksum_check_fn report, void *ctx, cksum_check_summary_t *sum) {
+    memset(sum, 0, sizeof(*sum));
+    size_t workers = resolve_workers(opt);
+    check_queue_t q;
+    q.cap = workers * 64;
+    q.len = 0;
+    q.eof = 0;
+    q.opt = opt;
+    q.file_threads = workers == 1 ? 0 : 1;
+    q.report = report;
+    q.ctx = ctx;
+    q.sum = sum;
+    q.heap = (check_item_t *)malloc(q.cap * sizeof(check_item_t));
+    pthread_t *ths = (pthread_t *)malloc(workers * sizeof(pthread_t));
+    if (!q.heap || !ths) {
+        perror("cksum: malloc");
+        free(q.heap); free(ths);
+        return -1;
+    }
+    pthread_mutex_init(&q.mu, NULL);
+    pthread_mutex_init(&q.report_mu, NULL);
+    pthread_cond_init(&q.not_empty, NULL);
+    pthread_cond_init(&q.not_full, NULL);
+
+    char *line = NULL;
+    size_t line_cap = 0;
+    size_t started = 0;
+    int spawned = 0;
+    for (;;) {
+        ssize_t n = getline(&line, &line_cap, manifest);
+        if (n < 0) break;
+        check_item_t item;
+        if (parse_manifest_line(line, &item) != 0) {
+            pthread_mutex_lock(&q.report_mu);
+            sum->malformed++;
+            pthread_mutex_unlock(&q.report_mu);
+            continue;
+        }
+        pthread_mutex_lock(&q.mu);
+        while (started > 0 && q.len == q.cap) pthread_cond_wait(&q.not_full, &q.mu);
+        if (q.len == q.cap) check_drain(&q);
+        heap_push(&q, item);
+        pthread_cond_signal(&q.not_empty);
+        int full = q.len == q.cap;
+        pthread_mutex_unlock(&q.mu);
+        // Fill the first window before starting so the largest entries go first.
+        if (full && !spawned) {
+            spawned = 1;
+            for (; started < workers; ++started) {
+                if (pthread_create(&ths[started], NULL, check_worker, &q) != 0) break;
+            }
+        }
+    }
+    int ret = 0;
+    if (ferror(manifest)) {
+        perror("cksum: read manifest");
+        ret = -1;
+    }
+    free(line);
+    if (!spawned) {
+        for (; started < workers; ++started) {
+            if (pthread_create(&ths[started], NULL, check_worker, &q) != 0) break;
+        }
+    }
+    pthread_mutex_lock(&q.mu);
+    q.eof = 1;
+    pthread_cond_broadcast(&q.not_empty);
+    pthread_mutex_unlock(&q.mu);
+    for (size_t i = 0; i < started; ++i) pthread_join(ths[i], NULL);
+    check_drain(&q);
+
+    pthread_cond_destroy(&q.not_full);
+    pthread_cond_destroy(&q.not_empty);
+    pthread_mutex_destroy(&q.report_mu);
+    pthread_mutex_destroy(&q.mu);
+    free(q.heap); free(ths);
+    return ret;
+}
@@ -1,8 +1,65 @@
 #ifndef CKSUM_H
 #define CKSUM_H
 #include <stdint.h>
+#include <stddef.h>
 #include <stdio.h>
-void init_crc32_table();
+typedef enum cksum_algo {
+    CKSUM_ALGO_CRC = 0,  // POSIX cksum: MSB-first, length suffix, final inversion
+    CKSUM_ALGO_CRC32B,   // zlib / Ethernet CRC-32
+    CKSUM_ALGO_CRC32C    // Castagnoli, SSE4.2 crc32 when available
+} cksum_algo_t;
+// Streaming hasher shared by every algorithm; feed blocks in order, then final.
+typedef struct cksum_hasher {
+    cksum_algo_t algo;
+    uint32_t reg;
+    unsigned long long total;
+} cksum_hasher_t;
+struct cksum_cache;
+typedef struct cksum_options {
+    cksum_algo_t algo;
+    size_t workers;             // 0 = auto
+    struct cksum_cache *cache;  // optional, see cache.h
+    int count;                  // --count: lines and words from the same pass, bypasses the cache
+} cksum_options_t;
+typedef struct cksum_result {
+    uint32_t crc;
+    unsigned long long total;
+    size_t lines;   // filled by cksum_fd_count only
+    size_t words;
+    int error;  // errno of the failed open/read, 0 on success
+} cksum_result_t;
+typedef void (*cksum_emit_fn)(const char *path, const cksum_result_t *r, void *ctx);
+typedef enum cksum_check_status {
+    CKSUM_CHECK_OK = 0,
+    CKSUM_CHECK_FAILED,     // checksum or size differs from the manifest
+    CKSUM_CHECK_UNREADABLE  // r->error holds the errno
+} cksum_check_status_t;
+typedef struct cksum_check_summary {
+    size_t ok;
+    size_t failed;
+    size_t unreadable;
+    size_t malformed;
+} cksum_check_summary_t;
+// Called from worker threads, one at a time, in completion order.
+typedef void (*cksum_check_fn)(const char *path, cksum_check_status_t status, const cksum_result_t *r, void *ctx);
 uint32_t update_crc(uint32_t crc,unsigned char *buf, int len);
+// CRC of A||B from crc(A), crc(B) and len(B), both started from a zero register
+uint32_t crc_combine(uint32_t crc_a, uint32_t crc_b, unsigned long long len_b);
+int cksum_algo_from_name(const char *name, cksum_algo_t *out);
+const char *cksum_algo_name(cksum_algo_t algo);
+void cksum_hasher_init(cksum_hasher_t *h, cksum_algo_t algo);
+void cksum_hasher_update(cksum_hasher_t *h, const void *buf, size_t len);
+uint32_t cksum_hasher_final(const cksum_hasher_t *h);
+// max_threads == 0 lets a large regular file use every online CPU
+int cksum_fd(int fd, cksum_algo_t algo, size_t max_threads, cksum_result_t *out);
+// One sequential pass that feeds every block to the CRC and then to the wc
+// counter while it is still in cache.
+int cksum_fd_count(int fd, cksum_algo_t algo, cksum_result_t *out);
 int cksum_stream(int fd, const char *name);
+// Checksums paths on a pool of workers and calls emit in argument order.
+int cksum_paths(const char *const *paths, size_t n, const cksum_options_t *opt, cksum_emit_fn emit, void *ctx);
+// Verifies "CRC SIZE NAME" lines read from manifest on a pool of workers.
+int cksum_check(FILE *manifest, const cksum_options_t *opt, cksum_check_fn report, void *ctx, cksum_check_summary_t *sum);
+// Command-line entry point; main() calls it unless built with UNIXC_MULTICALL.
+int cksum_main(int argc, char **argv);
 #endif
\ No newline at end of file
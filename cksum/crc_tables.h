@@ -0,0 +1,672 @@
+// Generated by cksum/gen/crc_gen.c, do not edit.
+#ifndef CKSUM_CRC_TABLES_H
+#define CKSUM_CRC_TABLES_H
+#include <stdint.h>
+
+#define CRC_TABLES_LANE 4096u
+
+// POSIX cksum, MSB-first, polynomial 0x04C11DB7
+static const uint32_t crc32_table[256] = {
+    0x00000000u, 0x04c11db7u, 0x09823b6eu, 0x0d4326d9u, 0x130476dcu, 0x17c56b6bu, 0x1a864db2u, 0x1e475005u,
+    0x2608edb8u, 0x22c9f00fu, 0x2f8ad6d6u, 0x2b4bcb61u, 0x350c9b64u, 0x31cd86d3u, 0x3c8ea00au, 0x384fbdbdu,
+    0x4c11db70u, 0x48d0c6c7u, 0x4593e01eu, 0x4152fda9u, 0x5f15adacu, 0x5bd4b01bu, 0x569796c2u, 0x52568b75u,
+    0x6a1936c8u, 0x6ed82b7fu, 0x639b0da6u, 0x675a1011u, 0x791d4014u, 0x7ddc5da3u, 0x709f7b7au, 0x745e66cdu,
+    0x9823b6e0u, 0x9ce2ab57u, 0x91a18d8eu, 0x95609039u, 0x8b27c03cu, 0x8fe6dd8bu, 0x82a5fb52u, 0x8664e6e5u,
+    0xbe2b5b58u, 0xbaea46efu, 0xb7a96036u, 0xb3687d81u, 0xad2f2d84u, 0xa9ee3033u, 0xa4ad16eau, 0xa06c0b5du,
+    0xd4326d90u, 0xd0f37027u, 0xddb056feu, 0xd9714b49u, 0xc7361b4cu, 0xc3f706fbu, 0xceb42022u, 0xca753d95u,
+    0xf23a8028u, 0xf6fb9d9fu, 0xfbb8bb46u, 0xff79a6f1u, 0xe13ef6f4u, 0xe5ffeb43u, 0xe8bccd9au, 0xec7dd02du,
+    0x34867077u, 0x30476dc0u, 0x3d044b19u, 0x39c556aeu, 0x278206abu, 0x23431b1cu, 0x2e003dc5u, 0x2ac12072u,
+    0x128e9dcfu, 0x164f8078u, 0x1b0ca6a1u, 0x1fcdbb16u, 0x018aeb13u, 0x054bf6a4u, 0x0808d07du, 0x0cc9cdcau,
+    0x7897ab07u, 0x7c56b6b0u, 0x71159069u, 0x75d48ddeu, 0x6b93dddbu, 0x6f52c06cu, 0x6211e6b5u, 0x66d0fb02u,
+    0x5e9f46bfu, 0x5a5e5b08u, 0x571d7dd1u, 0x53dc6066u, 0x4d9b3063u, 0x495a2dd4u, 0x44190b0du, 0x40d816bau,
+    0xaca5c697u, 0xa864db20u, 0xa527fdf9u, 0xa1e6e04eu, 0xbfa1b04bu, 0xbb60adfcu, 0xb6238b25u, 0xb2e29692u,
+    0x8aad2b2fu, 0x8e6c3698u, 0x832f1041u, 0x87ee0df6u, 0x99a95df3u, 0x9d684044u, 0x902b669du, 0x94ea7b2au,
+    0xe0b41de7u, 0xe4750050u, 0xe9362689u, 0xedf73b3eu, 0xf3b06b3bu, 0xf771768cu, 0xfa325055u, 0xfef34de2u,
+    0xc6bcf05fu, 0xc27dede8u, 0xcf3ecb31u, 0xcbffd686u, 0xd5b88683u, 0xd1799b34u, 0xdc3abdedu, 0xd8fba05au,
+    0x690ce0eeu, 0x6dcdfd59u, 0x608edb80u, 0x644fc637u, 0x7a089632u, 0x7ec98b85u, 0x738aad5cu, 0x774bb0ebu,
+    0x4f040d56u, 0x4bc510e1u, 0x46863638u, 0x42472b8fu, 0x5c007b8au, 0x58c1663du, 0x558240e4u, 0x51435d53u,
+    0x251d3b9eu, 0x21dc2629u, 0x2c9f00f0u, 0x285e1d47u, 0x36194d42u, 0x32d850f5u, 0x3f9b762cu, 0x3b5a6b9bu,
+    0x0315d626u, 0x07d4cb91u, 0x0a97ed48u, 0x0e56f0ffu, 0x1011a0fau, 0x14d0bd4du, 0x19939b94u, 0x1d528623u,
+    0xf12f560eu, 0xf5ee4bb9u, 0xf8ad6d60u, 0xfc6c70d7u, 0xe22b20d2u, 0xe6ea3d65u, 0xeba91bbcu, 0xef68060bu,
+    0xd727bbb6u, 0xd3e6a601u, 0xdea580d8u, 0xda649d6fu, 0xc423cd6au, 0xc0e2d0ddu, 0xcda1f604u, 0xc960ebb3u,
+    0xbd3e8d7eu, 0xb9ff90c9u, 0xb4bcb610u, 0xb07daba7u, 0xae3afba2u, 0xaafbe615u, 0xa7b8c0ccu, 0xa379dd7bu,
+    0x9b3660c6u, 0x9ff77d71u, 0x92b45ba8u, 0x9675461fu, 0x8832161au, 0x8cf30badu, 0x81b02d74u, 0x857130c3u,
+    0x5d8a9099u, 0x594b8d2eu, 0x5408abf7u, 0x50c9b640u, 0x4e8ee645u, 0x4a4ffbf2u, 0x470cdd2bu, 0x43cdc09cu,
+    0x7b827d21u, 0x7f436096u, 0x7200464fu, 0x76c15bf8u, 0x68860bfdu, 0x6c47164au, 0x61043093u, 0x65c52d24u,
+    0x119b4be9u, 0x155a565eu, 0x18197087u, 0x1cd86d30u, 0x029f3d35u, 0x065e2082u, 0x0b1d065bu, 0x0fdc1becu,
+    0x3793a651u, 0x3352bbe6u, 0x3e119d3fu, 0x3ad08088u, 0x2497d08du, 0x2056cd3au, 0x2d15ebe3u, 0x29d4f654u,
+    0xc5a92679u, 0xc1683bceu, 0xcc2b1d17u, 0xc8ea00a0u, 0xd6ad50a5u, 0xd26c4d12u, 0xdf2f6bcbu, 0xdbee767cu,
+    0xe3a1cbc1u, 0xe760d676u, 0xea23f0afu, 0xeee2ed18u, 0xf0a5bd1du, 0xf464a0aau, 0xf9278673u, 0xfde69bc4u,
+    0x89b8fd09u, 0x8d79e0beu, 0x803ac667u, 0x84fbdbd0u, 0x9abc8bd5u, 0x9e7d9662u, 0x933eb0bbu, 0x97ffad0cu,
+    0xafb010b1u, 0xab710d06u, 0xa6322bdfu, 0xa2f33668u, 0xbcb4666du, 0xb8757bdau, 0xb5365d03u, 0xb1f740b4u,
+};
+
+// crc32b (zlib), reflected polynomial 0xEDB88320
+static const uint32_t crc32b_table[256] = {
+    0x00000000u, 0x77073096u, 0xee0e612cu, 0x990951bau, 0x076dc419u, 0x706af48fu, 0xe963a535u, 0x9e6495a3u,
+    0x0edb8832u, 0x79dcb8a4u, 0xe0d5e91eu, 0x97d2d988u, 0x09b64c2bu, 0x7eb17cbdu, 0xe7b82d07u, 0x90bf1d91u,
+    0x1db71064u, 0x6ab020f2u, 0xf3b97148u, 0x84be41deu, 0x1adad47du, 0x6ddde4ebu, 0xf4d4b551u, 0x83d385c7u,
+    0x136c9856u, 0x646ba8c0u, 0xfd62f97au, 0x8a65c9ecu, 0x14015c4fu, 0x63066cd9u, 0xfa0f3d63u, 0x8d080df5u,
+    0x3b6e20c8u, 0x4c69105eu, 0xd56041e4u, 0xa2677172u, 0x3c03e4d1u, 0x4b04d447u, 0xd20d85fdu, 0xa50ab56bu,
+    0x35b5a8fau, 0x42b2986cu, 0xdbbbc9d6u, 0xacbcf940u, 0x32d86ce3u, 0x45df5c75u, 0xdcd60dcfu, 0xabd13d59u,
+    0x26d930acu, 0x51de003au, 0xc8d75180u, 0xbfd06116u, 0x21b4f4b5u, 0x56b3c423u, 0xcfba9599u, 0xb8bda50fu,
+    0x2802b89eu, 0x5f058808u, 0xc60cd9b2u, 0xb10be924u, 0x2f6f7c87u, 0x58684c11u, 0xc1611dabu, 0xb6662d3du,
+    0x76dc4190u, 0x01db7106u, 0x98d220bcu, 0xefd5102au, 0x71b18589u, 0x06b6b51fu, 0x9fbfe4a5u, 0xe8b8d433u,
+    0x7807c9a2u, 0x0f00f934u, 0x9609a88eu, 0xe10e9818u, 0x7f6a0dbbu, 0x086d3d2du, 0x91646c97u, 0xe6635c01u,
+    0x6b6b51f4u, 0x1c6c6162u, 0x856530d8u, 0xf262004eu, 0x6c0695edu, 0x1b01a57bu, 0x8208f4c1u, 0xf50fc457u,
+    0x65b0d9c6u, 0x12b7e950u, 0x8bbeb8eau, 0xfcb9887cu, 0x62dd1ddfu, 0x15da2d49u, 0x8cd37cf3u, 0xfbd44c65u,
+    0x4db26158u, 0x3ab551ceu, 0xa3bc0074u, 0xd4bb30e2u, 0x4adfa541u, 0x3dd895d7u, 0xa4d1c46du, 0xd3d6f4fbu,
+    0x4369e96au, 0x346ed9fcu, 0xad678846u, 0xda60b8d0u, 0x44042d73u, 0x33031de5u, 0xaa0a4c5fu, 0xdd0d7cc9u,
+    0x5005713cu, 0x270241aau, 0xbe0b1010u, 0xc90c2086u, 0x5768b525u, 0x206f85b3u, 0xb966d409u, 0xce61e49fu,
+    0x5edef90eu, 0x29d9c998u, 0xb0d09822u, 0xc7d7a8b4u, 0x59b33d17u, 0x2eb40d81u, 0xb7bd5c3bu, 0xc0ba6cadu,
+    0xedb88320u, 0x9abfb3b6u, 0x03b6e20cu, 0x74b1d29au, 0xead54739u, 0x9dd277afu, 0x04db2615u, 0x73dc1683u,
+    0xe3630b12u, 0x94643b84u, 0x0d6d6a3eu, 0x7a6a5aa8u, 0xe40ecf0bu, 0x9309ff9du, 0x0a00ae27u, 0x7d079eb1u,
+    0xf00f9344u, 0x8708a3d2u, 0x1e01f268u, 0x6906c2feu, 0xf762575du, 0x806567cbu, 0x196c3671u, 0x6e6b06e7u,
+    0xfed41b76u, 0x89d32be0u, 0x10da7a5au, 0x67dd4accu, 0xf9b9df6fu, 0x8ebeeff9u, 0x17b7be43u, 0x60b08ed5u,
+    0xd6d6a3e8u, 0xa1d1937eu, 0x38d8c2c4u, 0x4fdff252u, 0xd1bb67f1u, 0xa6bc5767u, 0x3fb506ddu, 0x48b2364bu,
+    0xd80d2bdau, 0xaf0a1b4cu, 0x36034af6u, 0x41047a60u, 0xdf60efc3u, 0xa867df55u, 0x316e8eefu, 0x4669be79u,
+    0xcb61b38cu, 0xbc66831au, 0x256fd2a0u, 0x5268e236u, 0xcc0c7795u, 0xbb0b4703u, 0x220216b9u, 0x5505262fu,
+    0xc5ba3bbeu, 0xb2bd0b28u, 0x2bb45a92u, 0x5cb36a04u, 0xc2d7ffa7u, 0xb5d0cf31u, 0x2cd99e8bu, 0x5bdeae1du,
+    0x9b64c2b0u, 0xec63f226u, 0x756aa39cu, 0x026d930au, 0x9c0906a9u, 0xeb0e363fu, 0x72076785u, 0x05005713u,
+    0x95bf4a82u, 0xe2b87a14u, 0x7bb12baeu, 0x0cb61b38u, 0x92d28e9bu, 0xe5d5be0du, 0x7cdcefb7u, 0x0bdbdf21u,
+    0x86d3d2d4u, 0xf1d4e242u, 0x68ddb3f8u, 0x1fda836eu, 0x81be16cdu, 0xf6b9265bu, 0x6fb077e1u, 0x18b74777u,
+    0x88085ae6u, 0xff0f6a70u, 0x66063bcau, 0x11010b5cu, 0x8f659effu, 0xf862ae69u, 0x616bffd3u, 0x166ccf45u,
+    0xa00ae278u, 0xd70dd2eeu, 0x4e048354u, 0x3903b3c2u, 0xa7672661u, 0xd06016f7u, 0x4969474du, 0x3e6e77dbu,
+    0xaed16a4au, 0xd9d65adcu, 0x40df0b66u, 0x37d83bf0u, 0xa9bcae53u, 0xdebb9ec5u, 0x47b2cf7fu, 0x30b5ffe9u,
+    0xbdbdf21cu, 0xcabac28au, 0x53b39330u, 0x24b4a3a6u, 0xbad03605u, 0xcdd70693u, 0x54de5729u, 0x23d967bfu,
+    0xb3667a2eu, 0xc4614ab8u, 0x5d681b02u, 0x2a6f2b94u, 0xb40bbe37u, 0xc30c8ea1u, 0x5a05df1bu, 0x2d02ef8du,
+};
+static const uint32_t crc32b_lane_shift[2][4][256] = {
+    {
+        {
+            0x00000000u, 0x5ad8a92cu, 0xb5b15258u, 0xef69fb74u, 0xb013a2f1u, 0xeacb0bddu, 0x05a2f0a9u, 0x5f7a5985u,
+            0xbb5643a3u, 0xe18eea8fu, 0x0ee711fbu, 0x543fb8d7u, 0x0b45e152u, 0x519d487eu, 0xbef4b30au, 0xe42c1a26u,
+            0xaddd8107u, 0xf705282bu, 0x186cd35fu, 0x42b47a73u, 0x1dce23f6u, 0x47168adau, 0xa87f71aeu, 0xf2a7d882u,
+            0x168bc2a4u, 0x4c536b88u, 0xa33a90fcu, 0xf9e239d0u, 0xa6986055u, 0xfc40c979u, 0x1329320du, 0x49f19b21u,
+            0x80ca044fu, 0xda12ad63u, 0x357b5617u, 0x6fa3ff3bu, 0x30d9a6beu, 0x6a010f92u, 0x8568f4e6u, 0xdfb05dcau,
+            0x3b9c47ecu, 0x6144eec0u, 0x8e2d15b4u, 0xd4f5bc98u, 0x8b8fe51du, 0xd1574c31u, 0x3e3eb745u, 0x64e61e69u,
+            0x2d178548u, 0x77cf2c64u, 0x98a6d710u, 0xc27e7e3cu, 0x9d0427b9u, 0xc7dc8e95u, 0x28b575e1u, 0x726ddccdu,
+            0x9641c6ebu, 0xcc996fc7u, 0x23f094b3u, 0x79283d9fu, 0x2652641au, 0x7c8acd36u, 0x93e33642u, 0xc93b9f6eu,
+            0xdae50edfu, 0x803da7f3u, 0x6f545c87u, 0x358cf5abu, 0x6af6ac2eu, 0x302e0502u, 0xdf47fe76u, 0x859f575au,
+            0x61b34d7cu, 0x3b6be450u, 0xd4021f24u, 0x8edab608u, 0xd1a0ef8du, 0x8b7846a1u, 0x6411bdd5u, 0x3ec914f9u,
+            0x77388fd8u, 0x2de026f4u, 0xc289dd80u, 0x985174acu, 0xc72b2d29u, 0x9df38405u, 0x729a7f71u, 0x2842d65du,
+            0xcc6ecc7bu, 0x96b66557u, 0x79df9e23u, 0x2307370fu, 0x7c7d6e8au, 0x26a5c7a6u, 0xc9cc3cd2u, 0x931495feu,
+            0x5a2f0a90u, 0x00f7a3bcu, 0xef9e58c8u, 0xb546f1e4u, 0xea3ca861u, 0xb0e4014du, 0x5f8dfa39u, 0x05555315u,
+            0xe1794933u, 0xbba1e01fu, 0x54c81b6bu, 0x0e10b247u, 0x516aebc2u, 0x0bb242eeu, 0xe4dbb99au, 0xbe0310b6u,
+            0xf7f28b97u, 0xad2a22bbu, 0x4243d9cfu, 0x189b70e3u, 0x47e12966u, 0x1d39804au, 0xf2507b3eu, 0xa888d212u,
+            0x4ca4c834u, 0x167c6118u, 0xf9159a6cu, 0xa3cd3340u, 0xfcb76ac5u, 0xa66fc3e9u, 0x4906389du, 0x13de91b1u,
+            0x6ebb1bffu, 0x3463b2d3u, 0xdb0a49a7u, 0x81d2e08bu, 0xdea8b90eu, 0x84701022u, 0x6b19eb56u, 0x31c1427au,
+            0xd5ed585cu, 0x8f35f170u, 0x605c0a04u, 0x3a84a328u, 0x65fefaadu, 0x3f265381u, 0xd04fa8f5u, 0x8a9701d9u,
+            0xc3669af8u, 0x99be33d4u, 0x76d7c8a0u, 0x2c0f618cu, 0x73753809u, 0x29ad9125u, 0xc6c46a51u, 0x9c1cc37du,
+            0x7830d95bu, 0x22e87077u, 0xcd818b03u, 0x9759222fu, 0xc8237baau, 0x92fbd286u, 0x7d9229f2u, 0x274a80deu,
+            0xee711fb0u, 0xb4a9b69cu, 0x5bc04de8u, 0x0118e4c4u, 0x5e62bd41u, 0x04ba146du, 0xebd3ef19u, 0xb10b4635u,
+            0x55275c13u, 0x0ffff53fu, 0xe0960e4bu, 0xba4ea767u, 0xe534fee2u, 0xbfec57ceu, 0x5085acbau, 0x0a5d0596u,
+            0x43ac9eb7u, 0x1974379bu, 0xf61dccefu, 0xacc565c3u, 0xf3bf3c46u, 0xa967956au, 0x460e6e1eu, 0x1cd6c732u,
+            0xf8fadd14u, 0xa2227438u, 0x4d4b8f4cu, 0x17932660u, 0x48e97fe5u, 0x1231d6c9u, 0xfd582dbdu, 0xa7808491u,
+            0xb45e1520u, 0xee86bc0cu, 0x01ef4778u, 0x5b37ee54u, 0x044db7d1u, 0x5e951efdu, 0xb1fce589u, 0xeb244ca5u,
+            0x0f085683u, 0x55d0ffafu, 0xbab904dbu, 0xe061adf7u, 0xbf1bf472u, 0xe5c35d5eu, 0x0aaaa62au, 0x50720f06u,
+            0x19839427u, 0x435b3d0bu, 0xac32c67fu, 0xf6ea6f53u, 0xa99036d6u, 0xf3489ffau, 0x1c21648eu, 0x46f9cda2u,
+            0xa2d5d784u, 0xf80d7ea8u, 0x176485dcu, 0x4dbc2cf0u, 0x12c67575u, 0x481edc59u, 0xa777272du, 0xfdaf8e01u,
+            0x3494116fu, 0x6e4cb843u, 0x81254337u, 0xdbfdea1bu, 0x8487b39eu, 0xde5f1ab2u, 0x3136e1c6u, 0x6bee48eau,
+            0x8fc252ccu, 0xd51afbe0u, 0x3a730094u, 0x60aba9b8u, 0x3fd1f03du, 0x65095911u, 0x8a60a265u, 0xd0b80b49u,
+            0x99499068u, 0xc3913944u, 0x2cf8c230u, 0x76206b1cu, 0x295a3299u, 0x73829bb5u, 0x9ceb60c1u, 0xc633c9edu,
+            0x221fd3cbu, 0x78c77ae7u, 0x97ae8193u, 0xcd7628bfu, 0x920c713au, 0xc8d4d816u, 0x27bd2362u, 0x7d658a4eu,
+        },
+        {
+            0x00000000u, 0xdd7637feu, 0x619d69bdu, 0xbceb5e43u, 0xc33ad37au, 0x1e4ce484u, 0xa2a7bac7u, 0x7fd18d39u,
+            0x5d04a0b5u, 0x8072974bu, 0x3c99c908u, 0xe1effef6u, 0x9e3e73cfu, 0x43484431u, 0xffa31a72u, 0x22d52d8cu,
+            0xba09416au, 0x677f7694u, 0xdb9428d7u, 0x06e21f29u, 0x79339210u, 0xa445a5eeu, 0x18aefbadu, 0xc5d8cc53u,
+            0xe70de1dfu, 0x3a7bd621u, 0x86908862u, 0x5be6bf9cu, 0x243732a5u, 0xf941055bu, 0x45aa5b18u, 0x98dc6ce6u,
+            0xaf638495u, 0x7215b36bu, 0xcefeed28u, 0x1388dad6u, 0x6c5957efu, 0xb12f6011u, 0x0dc43e52u, 0xd0b209acu,
+            0xf2672420u, 0x2f1113deu, 0x93fa4d9du, 0x4e8c7a63u, 0x315df75au, 0xec2bc0a4u, 0x50c09ee7u, 0x8db6a919u,
+            0x156ac5ffu, 0xc81cf201u, 0x74f7ac42u, 0xa9819bbcu, 0xd6501685u, 0x0b26217bu, 0xb7cd7f38u, 0x6abb48c6u,
+            0x486e654au, 0x951852b4u, 0x29f30cf7u, 0xf4853b09u, 0x8b54b630u, 0x562281ceu, 0xeac9df8du, 0x37bfe873u,
+            0x85b60f6bu, 0x58c03895u, 0xe42b66d6u, 0x395d5128u, 0x468cdc11u, 0x9bfaebefu, 0x2711b5acu, 0xfa678252u,
+            0xd8b2afdeu, 0x05c49820u, 0xb92fc663u, 0x6459f19du, 0x1b887ca4u, 0xc6fe4b5au, 0x7a151519u, 0xa76322e7u,
+            0x3fbf4e01u, 0xe2c979ffu, 0x5e2227bcu, 0x83541042u, 0xfc859d7bu, 0x21f3aa85u, 0x9d18f4c6u, 0x406ec338u,
+            0x62bbeeb4u, 0xbfcdd94au, 0x03268709u, 0xde50b0f7u, 0xa1813dceu, 0x7cf70a30u, 0xc01c5473u, 0x1d6a638du,
+            0x2ad58bfeu, 0xf7a3bc00u, 0x4b48e243u, 0x963ed5bdu, 0xe9ef5884u, 0x34996f7au, 0x88723139u, 0x550406c7u,
+            0x77d12b4bu, 0xaaa71cb5u, 0x164c42f6u, 0xcb3a7508u, 0xb4ebf831u, 0x699dcfcfu, 0xd576918cu, 0x0800a672u,
+            0x90dcca94u, 0x4daafd6au, 0xf141a329u, 0x2c3794d7u, 0x53e619eeu, 0x8e902e10u, 0x327b7053u, 0xef0d47adu,
+            0xcdd86a21u, 0x10ae5ddfu, 0xac45039cu, 0x71333462u, 0x0ee2b95bu, 0xd3948ea5u, 0x6f7fd0e6u, 0xb209e718u,
+            0xd01d1897u, 0x0d6b2f69u, 0xb180712au, 0x6cf646d4u, 0x1327cbedu, 0xce51fc13u, 0x72baa250u, 0xafcc95aeu,
+            0x8d19b822u, 0x506f8fdcu, 0xec84d19fu, 0x31f2e661u, 0x4e236b58u, 0x93555ca6u, 0x2fbe02e5u, 0xf2c8351bu,
+            0x6a1459fdu, 0xb7626e03u, 0x0b893040u, 0xd6ff07beu, 0xa92e8a87u, 0x7458bd79u, 0xc8b3e33au, 0x15c5d4c4u,
+            0x3710f948u, 0xea66ceb6u, 0x568d90f5u, 0x8bfba70bu, 0xf42a2a32u, 0x295c1dccu, 0x95b7438fu, 0x48c17471u,
+            0x7f7e9c02u, 0xa208abfcu, 0x1ee3f5bfu, 0xc395c241u, 0xbc444f78u, 0x61327886u, 0xddd926c5u, 0x00af113bu,
+            0x227a3cb7u, 0xff0c0b49u, 0x43e7550au, 0x9e9162f4u, 0xe140efcdu, 0x3c36d833u, 0x80dd8670u, 0x5dabb18eu,
+            0xc577dd68u, 0x1801ea96u, 0xa4eab4d5u, 0x799c832bu, 0x064d0e12u, 0xdb3b39ecu, 0x67d067afu, 0xbaa65051u,
+            0x98737dddu, 0x45054a23u, 0xf9ee1460u, 0x2498239eu, 0x5b49aea7u, 0x863f9959u, 0x3ad4c71au, 0xe7a2f0e4u,
+            0x55ab17fcu, 0x88dd2002u, 0x34367e41u, 0xe94049bfu, 0x9691c486u, 0x4be7f378u, 0xf70cad3bu, 0x2a7a9ac5u,
+            0x08afb749u, 0xd5d980b7u, 0x6932def4u, 0xb444e90au, 0xcb956433u, 0x16e353cdu, 0xaa080d8eu, 0x777e3a70u,
+            0xefa25696u, 0x32d46168u, 0x8e3f3f2bu, 0x534908d5u, 0x2c9885ecu, 0xf1eeb212u, 0x4d05ec51u, 0x9073dbafu,
+            0xb2a6f623u, 0x6fd0c1ddu, 0xd33b9f9eu, 0x0e4da860u, 0x719c2559u, 0xacea12a7u, 0x10014ce4u, 0xcd777b1au,
+            0xfac89369u, 0x27bea497u, 0x9b55fad4u, 0x4623cd2au, 0x39f24013u, 0xe48477edu, 0x586f29aeu, 0x85191e50u,
+            0xa7cc33dcu, 0x7aba0422u, 0xc6515a61u, 0x1b276d9fu, 0x64f6e0a6u, 0xb980d758u, 0x056b891bu, 0xd81dbee5u,
+            0x40c1d203u, 0x9db7e5fdu, 0x215cbbbeu, 0xfc2a8c40u, 0x83fb0179u, 0x5e8d3687u, 0xe26668c4u, 0x3f105f3au,
+            0x1dc572b6u, 0xc0b34548u, 0x7c581b0bu, 0xa12e2cf5u, 0xdeffa1ccu, 0x03899632u, 0xbf62c871u, 0x6214ff8fu,
+        },
+        {
+            0x00000000u, 0x7b4b376fu, 0xf6966edeu, 0x8ddd59b1u, 0x365ddbfdu, 0x4d16ec92u, 0xc0cbb523u, 0xbb80824cu,
+            0x6cbbb7fau, 0x17f08095u, 0x9a2dd924u, 0xe166ee4bu, 0x5ae66c07u, 0x21ad5b68u, 0xac7002d9u, 0xd73b35b6u,
+            0xd9776ff4u, 0xa23c589bu, 0x2fe1012au, 0x54aa3645u, 0xef2ab409u, 0x94618366u, 0x19bcdad7u, 0x62f7edb8u,
+            0xb5ccd80eu, 0xce87ef61u, 0x435ab6d0u, 0x381181bfu, 0x839103f3u, 0xf8da349cu, 0x75076d2du, 0x0e4c5a42u,
+            0x699fd9a9u, 0x12d4eec6u, 0x9f09b777u, 0xe4428018u, 0x5fc20254u, 0x2489353bu, 0xa9546c8au, 0xd21f5be5u,
+            0x05246e53u, 0x7e6f593cu, 0xf3b2008du, 0x88f937e2u, 0x3379b5aeu, 0x483282c1u, 0xc5efdb70u, 0xbea4ec1fu,
+            0xb0e8b65du, 0xcba38132u, 0x467ed883u, 0x3d35efecu, 0x86b56da0u, 0xfdfe5acfu, 0x7023037eu, 0x0b683411u,
+            0xdc5301a7u, 0xa71836c8u, 0x2ac56f79u, 0x518e5816u, 0xea0eda5au, 0x9145ed35u, 0x1c98b484u, 0x67d383ebu,
+            0xd33fb352u, 0xa874843du, 0x25a9dd8cu, 0x5ee2eae3u, 0xe56268afu, 0x9e295fc0u, 0x13f40671u, 0x68bf311eu,
+            0xbf8404a8u, 0xc4cf33c7u, 0x49126a76u, 0x32595d19u, 0x89d9df55u, 0xf292e83au, 0x7f4fb18bu, 0x040486e4u,
+            0x0a48dca6u, 0x7103ebc9u, 0xfcdeb278u, 0x87958517u, 0x3c15075bu, 0x475e3034u, 0xca836985u, 0xb1c85eeau,
+            0x66f36b5cu, 0x1db85c33u, 0x90650582u, 0xeb2e32edu, 0x50aeb0a1u, 0x2be587ceu, 0xa638de7fu, 0xdd73e910u,
+            0xbaa06afbu, 0xc1eb5d94u, 0x4c360425u, 0x377d334au, 0x8cfdb106u, 0xf7b68669u, 0x7a6bdfd8u, 0x0120e8b7u,
+            0xd61bdd01u, 0xad50ea6eu, 0x208db3dfu, 0x5bc684b0u, 0xe04606fcu, 0x9b0d3193u, 0x16d06822u, 0x6d9b5f4du,
+            0x63d7050fu, 0x189c3260u, 0x95416bd1u, 0xee0a5cbeu, 0x558adef2u, 0x2ec1e99du, 0xa31cb02cu, 0xd8578743u,
+            0x0f6cb2f5u, 0x7427859au, 0xf9fadc2bu, 0x82b1eb44u, 0x39316908u, 0x427a5e67u, 0xcfa707d6u, 0xb4ec30b9u,
+            0x7d0e60e5u, 0x0645578au, 0x8b980e3bu, 0xf0d33954u, 0x4b53bb18u, 0x30188c77u, 0xbdc5d5c6u, 0xc68ee2a9u,
+            0x11b5d71fu, 0x6afee070u, 0xe723b9c1u, 0x9c688eaeu, 0x27e80ce2u, 0x5ca33b8du, 0xd17e623cu, 0xaa355553u,
+            0xa4790f11u, 0xdf32387eu, 0x52ef61cfu, 0x29a456a0u, 0x9224d4ecu, 0xe96fe383u, 0x64b2ba32u, 0x1ff98d5du,
+            0xc8c2b8ebu, 0xb3898f84u, 0x3e54d635u, 0x451fe15au, 0xfe9f6316u, 0x85d45479u, 0x08090dc8u, 0x73423aa7u,
+            0x1491b94cu, 0x6fda8e23u, 0xe207d792u, 0x994ce0fdu, 0x22cc62b1u, 0x598755deu, 0xd45a0c6fu, 0xaf113b00u,
+            0x782a0eb6u, 0x036139d9u, 0x8ebc6068u, 0xf5f75707u, 0x4e77d54bu, 0x353ce224u, 0xb8e1bb95u, 0xc3aa8cfau,
+            0xcde6d6b8u, 0xb6ade1d7u, 0x3b70b866u, 0x403b8f09u, 0xfbbb0d45u, 0x80f03a2au, 0x0d2d639bu, 0x766654f4u,
+            0xa15d6142u, 0xda16562du, 0x57cb0f9cu, 0x2c8038f3u, 0x9700babfu, 0xec4b8dd0u, 0x6196d461u, 0x1adde30eu,
+            0xae31d3b7u, 0xd57ae4d8u, 0x58a7bd69u, 0x23ec8a06u, 0x986c084au, 0xe3273f25u, 0x6efa6694u, 0x15b151fbu,
+            0xc28a644du, 0xb9c15322u, 0x341c0a93u, 0x4f573dfcu, 0xf4d7bfb0u, 0x8f9c88dfu, 0x0241d16eu, 0x790ae601u,
+            0x7746bc43u, 0x0c0d8b2cu, 0x81d0d29du, 0xfa9be5f2u, 0x411b67beu, 0x3a5050d1u, 0xb78d0960u, 0xccc63e0fu,
+            0x1bfd0bb9u, 0x60b63cd6u, 0xed6b6567u, 0x96205208u, 0x2da0d044u, 0x56ebe72bu, 0xdb36be9au, 0xa07d89f5u,
+            0xc7ae0a1eu, 0xbce53d71u, 0x313864c0u, 0x4a7353afu, 0xf1f3d1e3u, 0x8ab8e68cu, 0x0765bf3du, 0x7c2e8852u,
+            0xab15bde4u, 0xd05e8a8bu, 0x5d83d33au, 0x26c8e455u, 0x9d486619u, 0xe6035176u, 0x6bde08c7u, 0x10953fa8u,
+            0x1ed965eau, 0x65925285u, 0xe84f0b34u, 0x93043c5bu, 0x2884be17u, 0x53cf8978u, 0xde12d0c9u, 0xa559e7a6u,
+            0x7262d210u, 0x0929e57fu, 0x84f4bcceu, 0xffbf8ba1u, 0x443f09edu, 0x3f743e82u, 0xb2a96733u, 0xc9e2505cu,
+        },
+        {
+            0x00000000u, 0xfa1cc1cau, 0x2f4885d5u, 0xd554441fu, 0x5e910baau, 0xa48dca60u, 0x71d98e7fu, 0x8bc54fb5u,
+            0xbd221754u, 0x473ed69eu, 0x926a9281u, 0x6876534bu, 0xe3b31cfeu, 0x19afdd34u, 0xccfb992bu, 0x36e758e1u,
+            0xa13528e9u, 0x5b29e923u, 0x8e7dad3cu, 0x74616cf6u, 0xffa42343u, 0x05b8e289u, 0xd0eca696u, 0x2af0675cu,
+            0x1c173fbdu, 0xe60bfe77u, 0x335fba68u, 0xc9437ba2u, 0x42863417u, 0xb89af5ddu, 0x6dceb1c2u, 0x97d27008u,
+            0x991b5793u, 0x63079659u, 0xb653d246u, 0x4c4f138cu, 0xc78a5c39u, 0x3d969df3u, 0xe8c2d9ecu, 0x12de1826u,
+            0x243940c7u, 0xde25810du, 0x0b71c512u, 0xf16d04d8u, 0x7aa84b6du, 0x80b48aa7u, 0x55e0ceb8u, 0xaffc0f72u,
+            0x382e7f7au, 0xc232beb0u, 0x1766faafu, 0xed7a3b65u, 0x66bf74d0u, 0x9ca3b51au, 0x49f7f105u, 0xb3eb30cfu,
+            0x850c682eu, 0x7f10a9e4u, 0xaa44edfbu, 0x50582c31u, 0xdb9d6384u, 0x2181a24eu, 0xf4d5e651u, 0x0ec9279bu,
+            0xe947a967u, 0x135b68adu, 0xc60f2cb2u, 0x3c13ed78u, 0xb7d6a2cdu, 0x4dca6307u, 0x989e2718u, 0x6282e6d2u,
+            0x5465be33u, 0xae797ff9u, 0x7b2d3be6u, 0x8131fa2cu, 0x0af4b599u, 0xf0e87453u, 0x25bc304cu, 0xdfa0f186u,
+            0x4872818eu, 0xb26e4044u, 0x673a045bu, 0x9d26c591u, 0x16e38a24u, 0xecff4beeu, 0x39ab0ff1u, 0xc3b7ce3bu,
+            0xf55096dau, 0x0f4c5710u, 0xda18130fu, 0x2004d2c5u, 0xabc19d70u, 0x51dd5cbau, 0x848918a5u, 0x7e95d96fu,
+            0x705cfef4u, 0x8a403f3eu, 0x5f147b21u, 0xa508baebu, 0x2ecdf55eu, 0xd4d13494u, 0x0185708bu, 0xfb99b141u,
+            0xcd7ee9a0u, 0x3762286au, 0xe2366c75u, 0x182aadbfu, 0x93efe20au, 0x69f323c0u, 0xbca767dfu, 0x46bba615u,
+            0xd169d61du, 0x2b7517d7u, 0xfe2153c8u, 0x043d9202u, 0x8ff8ddb7u, 0x75e41c7du, 0xa0b05862u, 0x5aac99a8u,
+            0x6c4bc149u, 0x96570083u, 0x4303449cu, 0xb91f8556u, 0x32dacae3u, 0xc8c60b29u, 0x1d924f36u, 0xe78e8efcu,
+            0x09fe548fu, 0xf3e29545u, 0x26b6d15au, 0xdcaa1090u, 0x576f5f25u, 0xad739eefu, 0x7827daf0u, 0x823b1b3au,
+            0xb4dc43dbu, 0x4ec08211u, 0x9b94c60eu, 0x618807c4u, 0xea4d4871u, 0x105189bbu, 0xc505cda4u, 0x3f190c6eu,
+            0xa8cb7c66u, 0x52d7bdacu, 0x8783f9b3u, 0x7d9f3879u, 0xf65a77ccu, 0x0c46b606u, 0xd912f219u, 0x230e33d3u,
+            0x15e96b32u, 0xeff5aaf8u, 0x3aa1eee7u, 0xc0bd2f2du, 0x4b786098u, 0xb164a152u, 0x6430e54du, 0x9e2c2487u,
+            0x90e5031cu, 0x6af9c2d6u, 0xbfad86c9u, 0x45b14703u, 0xce7408b6u, 0x3468c97cu, 0xe13c8d63u, 0x1b204ca9u,
+            0x2dc71448u, 0xd7dbd582u, 0x028f919du, 0xf8935057u, 0x73561fe2u, 0x894ade28u, 0x5c1e9a37u, 0xa6025bfdu,
+            0x31d02bf5u, 0xcbccea3fu, 0x1e98ae20u, 0xe4846feau, 0x6f41205fu, 0x955de195u, 0x4009a58au, 0xba156440u,
+            0x8cf23ca1u, 0x76eefd6bu, 0xa3bab974u, 0x59a678beu, 0xd263370bu, 0x287ff6c1u, 0xfd2bb2deu, 0x07377314u,
+            0xe0b9fde8u, 0x1aa53c22u, 0xcff1783du, 0x35edb9f7u, 0xbe28f642u, 0x44343788u, 0x91607397u, 0x6b7cb25du,
+            0x5d9beabcu, 0xa7872b76u, 0x72d36f69u, 0x88cfaea3u, 0x030ae116u, 0xf91620dcu, 0x2c4264c3u, 0xd65ea509u,
+            0x418cd501u, 0xbb9014cbu, 0x6ec450d4u, 0x94d8911eu, 0x1f1ddeabu, 0xe5011f61u, 0x30555b7eu, 0xca499ab4u,
+            0xfcaec255u, 0x06b2039fu, 0xd3e64780u, 0x29fa864au, 0xa23fc9ffu, 0x58230835u, 0x8d774c2au, 0x776b8de0u,
+            0x79a2aa7bu, 0x83be6bb1u, 0x56ea2faeu, 0xacf6ee64u, 0x2733a1d1u, 0xdd2f601bu, 0x087b2404u, 0xf267e5ceu,
+            0xc480bd2fu, 0x3e9c7ce5u, 0xebc838fau, 0x11d4f930u, 0x9a11b685u, 0x600d774fu, 0xb5593350u, 0x4f45f29au,
+            0xd8978292u, 0x228b4358u, 0xf7df0747u, 0x0dc3c68du, 0x86068938u, 0x7c1a48f2u, 0xa94e0cedu, 0x5352cd27u,
+            0x65b595c6u, 0x9fa9540cu, 0x4afd1013u, 0xb0e1d1d9u, 0x3b249e6cu, 0xc1385fa6u, 0x146c1bb9u, 0xee70da73u,
+        },
+    },
+    {
+        {
+            0x00000000u, 0xb566f6e2u, 0xb1bceb85u, 0x04da1d67u, 0xb808d14bu, 0x0d6e27a9u, 0x09b43aceu, 0xbcd2cc2cu,
+            0xab60a4d7u, 0x1e065235u, 0x1adc4f52u, 0xafbab9b0u, 0x1368759cu, 0xa60e837eu, 0xa2d49e19u, 0x17b268fbu,
+            0x8db04fefu, 0x38d6b90du, 0x3c0ca46au, 0x896a5288u, 0x35b89ea4u, 0x80de6846u, 0x84047521u, 0x316283c3u,
+            0x26d0eb38u, 0x93b61ddau, 0x976c00bdu, 0x220af65fu, 0x9ed83a73u, 0x2bbecc91u, 0x2f64d1f6u, 0x9a022714u,
+            0xc011999fu, 0x75776f7du, 0x71ad721au, 0xc4cb84f8u, 0x781948d4u, 0xcd7fbe36u, 0xc9a5a351u, 0x7cc355b3u,
+            0x6b713d48u, 0xde17cbaau, 0xdacdd6cdu, 0x6fab202fu, 0xd379ec03u, 0x661f1ae1u, 0x62c50786u, 0xd7a3f164u,
+            0x4da1d670u, 0xf8c72092u, 0xfc1d3df5u, 0x497bcb17u, 0xf5a9073bu, 0x40cff1d9u, 0x4415ecbeu, 0xf1731a5cu,
+            0xe6c172a7u, 0x53a78445u, 0x577d9922u, 0xe21b6fc0u, 0x5ec9a3ecu, 0xebaf550eu, 0xef754869u, 0x5a13be8bu,
+            0x5b52357fu, 0xee34c39du, 0xeaeedefau, 0x5f882818u, 0xe35ae434u, 0x563c12d6u, 0x52e60fb1u, 0xe780f953u,
+            0xf03291a8u, 0x4554674au, 0x418e7a2du, 0xf4e88ccfu, 0x483a40e3u, 0xfd5cb601u, 0xf986ab66u, 0x4ce05d84u,
+            0xd6e27a90u, 0x63848c72u, 0x675e9115u, 0xd23867f7u, 0x6eeaabdbu, 0xdb8c5d39u, 0xdf56405eu, 0x6a30b6bcu,
+            0x7d82de47u, 0xc8e428a5u, 0xcc3e35c2u, 0x7958c320u, 0xc58a0f0cu, 0x70ecf9eeu, 0x7436e489u, 0xc150126bu,
+            0x9b43ace0u, 0x2e255a02u, 0x2aff4765u, 0x9f99b187u, 0x234b7dabu, 0x962d8b49u, 0x92f7962eu, 0x279160ccu,
+            0x30230837u, 0x8545fed5u, 0x819fe3b2u, 0x34f91550u, 0x882bd97cu, 0x3d4d2f9eu, 0x399732f9u, 0x8cf1c41bu,
+            0x16f3e30fu, 0xa39515edu, 0xa74f088au, 0x1229fe68u, 0xaefb3244u, 0x1b9dc4a6u, 0x1f47d9c1u, 0xaa212f23u,
+            0xbd9347d8u, 0x08f5b13au, 0x0c2fac5du, 0xb9495abfu, 0x059b9693u, 0xb0fd6071u, 0xb4277d16u, 0x01418bf4u,
+            0xb6a46afeu, 0x03c29c1cu, 0x0718817bu, 0xb27e7799u, 0x0eacbbb5u, 0xbbca4d57u, 0xbf105030u, 0x0a76a6d2u,
+            0x1dc4ce29u, 0xa8a238cbu, 0xac7825acu, 0x191ed34eu, 0xa5cc1f62u, 0x10aae980u, 0x1470f4e7u, 0xa1160205u,
+            0x3b142511u, 0x8e72d3f3u, 0x8aa8ce94u, 0x3fce3876u, 0x831cf45au, 0x367a02b8u, 0x32a01fdfu, 0x87c6e93du,
+            0x907481c6u, 0x25127724u, 0x21c86a43u, 0x94ae9ca1u, 0x287c508du, 0x9d1aa66fu, 0x99c0bb08u, 0x2ca64deau,
+            0x76b5f361u, 0xc3d30583u, 0xc70918e4u, 0x726fee06u, 0xcebd222au, 0x7bdbd4c8u, 0x7f01c9afu, 0xca673f4du,
+            0xddd557b6u, 0x68b3a154u, 0x6c69bc33u, 0xd90f4ad1u, 0x65dd86fdu, 0xd0bb701fu, 0xd4616d78u, 0x61079b9au,
+            0xfb05bc8eu, 0x4e634a6cu, 0x4ab9570bu, 0xffdfa1e9u, 0x430d6dc5u, 0xf66b9b27u, 0xf2b18640u, 0x47d770a2u,
+            0x50651859u, 0xe503eebbu, 0xe1d9f3dcu, 0x54bf053eu, 0xe86dc912u, 0x5d0b3ff0u, 0x59d12297u, 0xecb7d475u,
+            0xedf65f81u, 0x5890a963u, 0x5c4ab404u, 0xe92c42e6u, 0x55fe8ecau, 0xe0987828u, 0xe442654fu, 0x512493adu,
+            0x4696fb56u, 0xf3f00db4u, 0xf72a10d3u, 0x424ce631u, 0xfe9e2a1du, 0x4bf8dcffu, 0x4f22c198u, 0xfa44377au,
+            0x6046106eu, 0xd520e68cu, 0xd1fafbebu, 0x649c0d09u, 0xd84ec125u, 0x6d2837c7u, 0x69f22aa0u, 0xdc94dc42u,
+            0xcb26b4b9u, 0x7e40425bu, 0x7a9a5f3cu, 0xcffca9deu, 0x732e65f2u, 0xc6489310u, 0xc2928e77u, 0x77f47895u,
+            0x2de7c61eu, 0x988130fcu, 0x9c5b2d9bu, 0x293ddb79u, 0x95ef1755u, 0x2089e1b7u, 0x2453fcd0u, 0x91350a32u,
+            0x868762c9u, 0x33e1942bu, 0x373b894cu, 0x825d7faeu, 0x3e8fb382u, 0x8be94560u, 0x8f335807u, 0x3a55aee5u,
+            0xa05789f1u, 0x15317f13u, 0x11eb6274u, 0xa48d9496u, 0x185f58bau, 0xad39ae58u, 0xa9e3b33fu, 0x1c8545ddu,
+            0x0b372d26u, 0xbe51dbc4u, 0xba8bc6a3u, 0x0fed3041u, 0xb33ffc6du, 0x06590a8fu, 0x028317e8u, 0xb7e5e10au,
+        },
+        {
+            0x00000000u, 0xb639d3bdu, 0xb702a13bu, 0x013b7286u, 0xb5744437u, 0x034d978au, 0x0276e50cu, 0xb44f36b1u,
+            0xb1998e2fu, 0x07a05d92u, 0x069b2f14u, 0xb0a2fca9u, 0x04edca18u, 0xb2d419a5u, 0xb3ef6b23u, 0x05d6b89eu,
+            0xb8421a1fu, 0x0e7bc9a2u, 0x0f40bb24u, 0xb9796899u, 0x0d365e28u, 0xbb0f8d95u, 0xba34ff13u, 0x0c0d2caeu,
+            0x09db9430u, 0xbfe2478du, 0xbed9350bu, 0x08e0e6b6u, 0xbcafd007u, 0x0a9603bau, 0x0bad713cu, 0xbd94a281u,
+            0xabf5327fu, 0x1dcce1c2u, 0x1cf79344u, 0xaace40f9u, 0x1e817648u, 0xa8b8a5f5u, 0xa983d773u, 0x1fba04ceu,
+            0x1a6cbc50u, 0xac556fedu, 0xad6e1d6bu, 0x1b57ced6u, 0xaf18f867u, 0x19212bdau, 0x181a595cu, 0xae238ae1u,
+            0x13b72860u, 0xa58efbddu, 0xa4b5895bu, 0x128c5ae6u, 0xa6c36c57u, 0x10fabfeau, 0x11c1cd6cu, 0xa7f81ed1u,
+            0xa22ea64fu, 0x141775f2u, 0x152c0774u, 0xa315d4c9u, 0x175ae278u, 0xa16331c5u, 0xa0584343u, 0x166190feu,
+            0x8c9b62bfu, 0x3aa2b102u, 0x3b99c384u, 0x8da01039u, 0x39ef2688u, 0x8fd6f535u, 0x8eed87b3u, 0x38d4540eu,
+            0x3d02ec90u, 0x8b3b3f2du, 0x8a004dabu, 0x3c399e16u, 0x8876a8a7u, 0x3e4f7b1au, 0x3f74099cu, 0x894dda21u,
+            0x34d978a0u, 0x82e0ab1du, 0x83dbd99bu, 0x35e20a26u, 0x81ad3c97u, 0x3794ef2au, 0x36af9dacu, 0x80964e11u,
+            0x8540f68fu, 0x33792532u, 0x324257b4u, 0x847b8409u, 0x3034b2b8u, 0x860d6105u, 0x87361383u, 0x310fc03eu,
+            0x276e50c0u, 0x9157837du, 0x906cf1fbu, 0x26552246u, 0x921a14f7u, 0x2423c74au, 0x2518b5ccu, 0x93216671u,
+            0x96f7deefu, 0x20ce0d52u, 0x21f57fd4u, 0x97ccac69u, 0x23839ad8u, 0x95ba4965u, 0x94813be3u, 0x22b8e85eu,
+            0x9f2c4adfu, 0x29159962u, 0x282eebe4u, 0x9e173859u, 0x2a580ee8u, 0x9c61dd55u, 0x9d5aafd3u, 0x2b637c6eu,
+            0x2eb5c4f0u, 0x988c174du, 0x99b765cbu, 0x2f8eb676u, 0x9bc180c7u, 0x2df8537au, 0x2cc321fcu, 0x9afaf241u,
+            0xc247c33fu, 0x747e1082u, 0x75456204u, 0xc37cb1b9u, 0x77338708u, 0xc10a54b5u, 0xc0312633u, 0x7608f58eu,
+            0x73de4d10u, 0xc5e79eadu, 0xc4dcec2bu, 0x72e53f96u, 0xc6aa0927u, 0x7093da9au, 0x71a8a81cu, 0xc7917ba1u,
+            0x7a05d920u, 0xcc3c0a9du, 0xcd07781bu, 0x7b3eaba6u, 0xcf719d17u, 0x79484eaau, 0x78733c2cu, 0xce4aef91u,
+            0xcb9c570fu, 0x7da584b2u, 0x7c9ef634u, 0xcaa72589u, 0x7ee81338u, 0xc8d1c085u, 0xc9eab203u, 0x7fd361beu,
+            0x69b2f140u, 0xdf8b22fdu, 0xdeb0507bu, 0x688983c6u, 0xdcc6b577u, 0x6aff66cau, 0x6bc4144cu, 0xddfdc7f1u,
+            0xd82b7f6fu, 0x6e12acd2u, 0x6f29de54u, 0xd9100de9u, 0x6d5f3b58u, 0xdb66e8e5u, 0xda5d9a63u, 0x6c6449deu,
+            0xd1f0eb5fu, 0x67c938e2u, 0x66f24a64u, 0xd0cb99d9u, 0x6484af68u, 0xd2bd7cd5u, 0xd3860e53u, 0x65bfddeeu,
+            0x60696570u, 0xd650b6cdu, 0xd76bc44bu, 0x615217f6u, 0xd51d2147u, 0x6324f2fau, 0x621f807cu, 0xd42653c1u,
+            0x4edca180u, 0xf8e5723du, 0xf9de00bbu, 0x4fe7d306u, 0xfba8e5b7u, 0x4d91360au, 0x4caa448cu, 0xfa939731u,
+            0xff452fafu, 0x497cfc12u, 0x48478e94u, 0xfe7e5d29u, 0x4a316b98u, 0xfc08b825u, 0xfd33caa3u, 0x4b0a191eu,
+            0xf69ebb9fu, 0x40a76822u, 0x419c1aa4u, 0xf7a5c919u, 0x43eaffa8u, 0xf5d32c15u, 0xf4e85e93u, 0x42d18d2eu,
+            0x470735b0u, 0xf13ee60du, 0xf005948bu, 0x463c4736u, 0xf2737187u, 0x444aa23au, 0x4571d0bcu, 0xf3480301u,
+            0xe52993ffu, 0x53104042u, 0x522b32c4u, 0xe412e179u, 0x505dd7c8u, 0xe6640475u, 0xe75f76f3u, 0x5166a54eu,
+            0x54b01dd0u, 0xe289ce6du, 0xe3b2bcebu, 0x558b6f56u, 0xe1c459e7u, 0x57fd8a5au, 0x56c6f8dcu, 0xe0ff2b61u,
+            0x5d6b89e0u, 0xeb525a5du, 0xea6928dbu, 0x5c50fb66u, 0xe81fcdd7u, 0x5e261e6au, 0x5f1d6cecu, 0xe924bf51u,
+            0xecf207cfu, 0x5acbd472u, 0x5bf0a6f4u, 0xedc97549u, 0x598643f8u, 0xefbf9045u, 0xee84e2c3u, 0x58bd317eu,
+        },
+        {
+            0x00000000u, 0x5ffe803fu, 0xbffd007eu, 0xe0038041u, 0xa48b06bdu, 0xfb758682u, 0x1b7606c3u, 0x448886fcu,
+            0x92670b3bu, 0xcd998b04u, 0x2d9a0b45u, 0x72648b7au, 0x36ec0d86u, 0x69128db9u, 0x89110df8u, 0xd6ef8dc7u,
+            0xffbf1037u, 0xa0419008u, 0x40421049u, 0x1fbc9076u, 0x5b34168au, 0x04ca96b5u, 0xe4c916f4u, 0xbb3796cbu,
+            0x6dd81b0cu, 0x32269b33u, 0xd2251b72u, 0x8ddb9b4du, 0xc9531db1u, 0x96ad9d8eu, 0x76ae1dcfu, 0x29509df0u,
+            0x240f262fu, 0x7bf1a610u, 0x9bf22651u, 0xc40ca66eu, 0x80842092u, 0xdf7aa0adu, 0x3f7920ecu, 0x6087a0d3u,
+            0xb6682d14u, 0xe996ad2bu, 0x09952d6au, 0x566bad55u, 0x12e32ba9u, 0x4d1dab96u, 0xad1e2bd7u, 0xf2e0abe8u,
+            0xdbb03618u, 0x844eb627u, 0x644d3666u, 0x3bb3b659u, 0x7f3b30a5u, 0x20c5b09au, 0xc0c630dbu, 0x9f38b0e4u,
+            0x49d73d23u, 0x1629bd1cu, 0xf62a3d5du, 0xa9d4bd62u, 0xed5c3b9eu, 0xb2a2bba1u, 0x52a13be0u, 0x0d5fbbdfu,
+            0x481e4c5eu, 0x17e0cc61u, 0xf7e34c20u, 0xa81dcc1fu, 0xec954ae3u, 0xb36bcadcu, 0x53684a9du, 0x0c96caa2u,
+            0xda794765u, 0x8587c75au, 0x6584471bu, 0x3a7ac724u, 0x7ef241d8u, 0x210cc1e7u, 0xc10f41a6u, 0x9ef1c199u,
+            0xb7a15c69u, 0xe85fdc56u, 0x085c5c17u, 0x57a2dc28u, 0x132a5ad4u, 0x4cd4daebu, 0xacd75aaau, 0xf329da95u,
+            0x25c65752u, 0x7a38d76du, 0x9a3b572cu, 0xc5c5d713u, 0x814d51efu, 0xdeb3d1d0u, 0x3eb05191u, 0x614ed1aeu,
+            0x6c116a71u, 0x33efea4eu, 0xd3ec6a0fu, 0x8c12ea30u, 0xc89a6cccu, 0x9764ecf3u, 0x77676cb2u, 0x2899ec8du,
+            0xfe76614au, 0xa188e175u, 0x418b6134u, 0x1e75e10bu, 0x5afd67f7u, 0x0503e7c8u, 0xe5006789u, 0xbafee7b6u,
+            0x93ae7a46u, 0xcc50fa79u, 0x2c537a38u, 0x73adfa07u, 0x37257cfbu, 0x68dbfcc4u, 0x88d87c85u, 0xd726fcbau,
+            0x01c9717du, 0x5e37f142u, 0xbe347103u, 0xe1caf13cu, 0xa54277c0u, 0xfabcf7ffu, 0x1abf77beu, 0x4541f781u,
+            0x903c98bcu, 0xcfc21883u, 0x2fc198c2u, 0x703f18fdu, 0x34b79e01u, 0x6b491e3eu, 0x8b4a9e7fu, 0xd4b41e40u,
+            0x025b9387u, 0x5da513b8u, 0xbda693f9u, 0xe25813c6u, 0xa6d0953au, 0xf92e1505u, 0x192d9544u, 0x46d3157bu,
+            0x6f83888bu, 0x307d08b4u, 0xd07e88f5u, 0x8f8008cau, 0xcb088e36u, 0x94f60e09u, 0x74f58e48u, 0x2b0b0e77u,
+            0xfde483b0u, 0xa21a038fu, 0x421983ceu, 0x1de703f1u, 0x596f850du, 0x06910532u, 0xe6928573u, 0xb96c054cu,
+            0xb433be93u, 0xebcd3eacu, 0x0bcebeedu, 0x54303ed2u, 0x10b8b82eu, 0x4f463811u, 0xaf45b850u, 0xf0bb386fu,
+            0x2654b5a8u, 0x79aa3597u, 0x99a9b5d6u, 0xc65735e9u, 0x82dfb315u, 0xdd21332au, 0x3d22b36bu, 0x62dc3354u,
+            0x4b8caea4u, 0x14722e9bu, 0xf471aedau, 0xab8f2ee5u, 0xef07a819u, 0xb0f92826u, 0x50faa867u, 0x0f042858u,
+            0xd9eba59fu, 0x861525a0u, 0x6616a5e1u, 0x39e825deu, 0x7d60a322u, 0x229e231du, 0xc29da35cu, 0x9d632363u,
+            0xd822d4e2u, 0x87dc54ddu, 0x67dfd49cu, 0x382154a3u, 0x7ca9d25fu, 0x23575260u, 0xc354d221u, 0x9caa521eu,
+            0x4a45dfd9u, 0x15bb5fe6u, 0xf5b8dfa7u, 0xaa465f98u, 0xeeced964u, 0xb130595bu, 0x5133d91au, 0x0ecd5925u,
+            0x279dc4d5u, 0x786344eau, 0x9860c4abu, 0xc79e4494u, 0x8316c268u, 0xdce84257u, 0x3cebc216u, 0x63154229u,
+            0xb5facfeeu, 0xea044fd1u, 0x0a07cf90u, 0x55f94fafu, 0x1171c953u, 0x4e8f496cu, 0xae8cc92du, 0xf1724912u,
+            0xfc2df2cdu, 0xa3d372f2u, 0x43d0f2b3u, 0x1c2e728cu, 0x58a6f470u, 0x0758744fu, 0xe75bf40eu, 0xb8a57431u,
+            0x6e4af9f6u, 0x31b479c9u, 0xd1b7f988u, 0x8e4979b7u, 0xcac1ff4bu, 0x953f7f74u, 0x753cff35u, 0x2ac27f0au,
+            0x0392e2fau, 0x5c6c62c5u, 0xbc6fe284u, 0xe39162bbu, 0xa719e447u, 0xf8e76478u, 0x18e4e439u, 0x471a6406u,
+            0x91f5e9c1u, 0xce0b69feu, 0x2e08e9bfu, 0x71f66980u, 0x357eef7cu, 0x6a806f43u, 0x8a83ef02u, 0xd57d6f3du,
+        },
+        {
+            0x00000000u, 0xfb083739u, 0x2d616833u, 0xd6695f0au, 0x5ac2d066u, 0xa1cae75fu, 0x77a3b855u, 0x8cab8f6cu,
+            0xb585a0ccu, 0x4e8d97f5u, 0x98e4c8ffu, 0x63ecffc6u, 0xef4770aau, 0x144f4793u, 0xc2261899u, 0x392e2fa0u,
+            0xb07a47d9u, 0x4b7270e0u, 0x9d1b2feau, 0x661318d3u, 0xeab897bfu, 0x11b0a086u, 0xc7d9ff8cu, 0x3cd1c8b5u,
+            0x05ffe715u, 0xfef7d02cu, 0x289e8f26u, 0xd396b81fu, 0x5f3d3773u, 0xa435004au, 0x725c5f40u, 0x89546879u,
+            0xbb8589f3u, 0x408dbecau, 0x96e4e1c0u, 0x6decd6f9u, 0xe1475995u, 0x1a4f6eacu, 0xcc2631a6u, 0x372e069fu,
+            0x0e00293fu, 0xf5081e06u, 0x2361410cu, 0xd8697635u, 0x54c2f959u, 0xafcace60u, 0x79a3916au, 0x82aba653u,
+            0x0bffce2au, 0xf0f7f913u, 0x269ea619u, 0xdd969120u, 0x513d1e4cu, 0xaa352975u, 0x7c5c767fu, 0x87544146u,
+            0xbe7a6ee6u, 0x457259dfu, 0x931b06d5u, 0x681331ecu, 0xe4b8be80u, 0x1fb089b9u, 0xc9d9d6b3u, 0x32d1e18au,
+            0xac7a15a7u, 0x5772229eu, 0x811b7d94u, 0x7a134aadu, 0xf6b8c5c1u, 0x0db0f2f8u, 0xdbd9adf2u, 0x20d19acbu,
+            0x19ffb56bu, 0xe2f78252u, 0x349edd58u, 0xcf96ea61u, 0x433d650du, 0xb8355234u, 0x6e5c0d3eu, 0x95543a07u,
+            0x1c00527eu, 0xe7086547u, 0x31613a4du, 0xca690d74u, 0x46c28218u, 0xbdcab521u, 0x6ba3ea2bu, 0x90abdd12u,
+            0xa985f2b2u, 0x528dc58bu, 0x84e49a81u, 0x7fecadb8u, 0xf34722d4u, 0x084f15edu, 0xde264ae7u, 0x252e7ddeu,
+            0x17ff9c54u, 0xecf7ab6du, 0x3a9ef467u, 0xc196c35eu, 0x4d3d4c32u, 0xb6357b0bu, 0x605c2401u, 0x9b541338u,
+            0xa27a3c98u, 0x59720ba1u, 0x8f1b54abu, 0x74136392u, 0xf8b8ecfeu, 0x03b0dbc7u, 0xd5d984cdu, 0x2ed1b3f4u,
+            0xa785db8du, 0x5c8decb4u, 0x8ae4b3beu, 0x71ec8487u, 0xfd470bebu, 0x064f3cd2u, 0xd02663d8u, 0x2b2e54e1u,
+            0x12007b41u, 0xe9084c78u, 0x3f611372u, 0xc469244bu, 0x48c2ab27u, 0xb3ca9c1eu, 0x65a3c314u, 0x9eabf42du,
+            0x83852d0fu, 0x788d1a36u, 0xaee4453cu, 0x55ec7205u, 0xd947fd69u, 0x224fca50u, 0xf426955au, 0x0f2ea263u,
+            0x36008dc3u, 0xcd08bafau, 0x1b61e5f0u, 0xe069d2c9u, 0x6cc25da5u, 0x97ca6a9cu, 0x41a33596u, 0xbaab02afu,
+            0x33ff6ad6u, 0xc8f75defu, 0x1e9e02e5u, 0xe59635dcu, 0x693dbab0u, 0x92358d89u, 0x445cd283u, 0xbf54e5bau,
+            0x867aca1au, 0x7d72fd23u, 0xab1ba229u, 0x50139510u, 0xdcb81a7cu, 0x27b02d45u, 0xf1d9724fu, 0x0ad14576u,
+            0x3800a4fcu, 0xc30893c5u, 0x1561cccfu, 0xee69fbf6u, 0x62c2749au, 0x99ca43a3u, 0x4fa31ca9u, 0xb4ab2b90u,
+            0x8d850430u, 0x768d3309u, 0xa0e46c03u, 0x5bec5b3au, 0xd747d456u, 0x2c4fe36fu, 0xfa26bc65u, 0x012e8b5cu,
+            0x887ae325u, 0x7372d41cu, 0xa51b8b16u, 0x5e13bc2fu, 0xd2b83343u, 0x29b0047au, 0xffd95b70u, 0x04d16c49u,
+            0x3dff43e9u, 0xc6f774d0u, 0x109e2bdau, 0xeb961ce3u, 0x673d938fu, 0x9c35a4b6u, 0x4a5cfbbcu, 0xb154cc85u,
+            0x2fff38a8u, 0xd4f70f91u, 0x029e509bu, 0xf99667a2u, 0x753de8ceu, 0x8e35dff7u, 0x585c80fdu, 0xa354b7c4u,
+            0x9a7a9864u, 0x6172af5du, 0xb71bf057u, 0x4c13c76eu, 0xc0b84802u, 0x3bb07f3bu, 0xedd92031u, 0x16d11708u,
+            0x9f857f71u, 0x648d4848u, 0xb2e41742u, 0x49ec207bu, 0xc547af17u, 0x3e4f982eu, 0xe826c724u, 0x132ef01du,
+            0x2a00dfbdu, 0xd108e884u, 0x0761b78eu, 0xfc6980b7u, 0x70c20fdbu, 0x8bca38e2u, 0x5da367e8u, 0xa6ab50d1u,
+            0x947ab15bu, 0x6f728662u, 0xb91bd968u, 0x4213ee51u, 0xceb8613du, 0x35b05604u, 0xe3d9090eu, 0x18d13e37u,
+            0x21ff1197u, 0xdaf726aeu, 0x0c9e79a4u, 0xf7964e9du, 0x7b3dc1f1u, 0x8035f6c8u, 0x565ca9c2u, 0xad549efbu,
+            0x2400f682u, 0xdf08c1bbu, 0x09619eb1u, 0xf269a988u, 0x7ec226e4u, 0x85ca11ddu, 0x53a34ed7u, 0xa8ab79eeu,
+            0x9185564eu, 0x6a8d6177u, 0xbce43e7du, 0x47ec0944u, 0xcb478628u, 0x304fb111u, 0xe626ee1bu, 0x1d2ed922u,
+        },
+    },
+};
+
+// crc32c (Castagnoli), reflected polynomial 0x82F63B78
+static const uint32_t crc32c_table[256] = {
+    0x00000000u, 0xf26b8303u, 0xe13b70f7u, 0x1350f3f4u, 0xc79a971fu, 0x35f1141cu, 0x26a1e7e8u, 0xd4ca64ebu,
+    0x8ad958cfu, 0x78b2dbccu, 0x6be22838u, 0x9989ab3bu, 0x4d43cfd0u, 0xbf284cd3u, 0xac78bf27u, 0x5e133c24u,
+    0x105ec76fu, 0xe235446cu, 0xf165b798u, 0x030e349bu, 0xd7c45070u, 0x25afd373u, 0x36ff2087u, 0xc494a384u,
+    0x9a879fa0u, 0x68ec1ca3u, 0x7bbcef57u, 0x89d76c54u, 0x5d1d08bfu, 0xaf768bbcu, 0xbc267848u, 0x4e4dfb4bu,
+    0x20bd8edeu, 0xd2d60dddu, 0xc186fe29u, 0x33ed7d2au, 0xe72719c1u, 0x154c9ac2u, 0x061c6936u, 0xf477ea35u,
+    0xaa64d611u, 0x580f5512u, 0x4b5fa6e6u, 0xb93425e5u, 0x6dfe410eu, 0x9f95c20du, 0x8cc531f9u, 0x7eaeb2fau,
+    0x30e349b1u, 0xc288cab2u, 0xd1d83946u, 0x23b3ba45u, 0xf779deaeu, 0x05125dadu, 0x1642ae59u, 0xe4292d5au,
+    0xba3a117eu, 0x4851927du, 0x5b016189u, 0xa96ae28au, 0x7da08661u, 0x8fcb0562u, 0x9c9bf696u, 0x6ef07595u,
+    0x417b1dbcu, 0xb3109ebfu, 0xa0406d4bu, 0x522bee48u, 0x86e18aa3u, 0x748a09a0u, 0x67dafa54u, 0x95b17957u,
+    0xcba24573u, 0x39c9c670u, 0x2a993584u, 0xd8f2b687u, 0x0c38d26cu, 0xfe53516fu, 0xed03a29bu, 0x1f682198u,
+    0x5125dad3u, 0xa34e59d0u, 0xb01eaa24u, 0x42752927u, 0x96bf4dccu, 0x64d4cecfu, 0x77843d3bu, 0x85efbe38u,
+    0xdbfc821cu, 0x2997011fu, 0x3ac7f2ebu, 0xc8ac71e8u, 0x1c661503u, 0xee0d9600u, 0xfd5d65f4u, 0x0f36e6f7u,
+    0x61c69362u, 0x93ad1061u, 0x80fde395u, 0x72966096u, 0xa65c047du, 0x5437877eu, 0x4767748au, 0xb50cf789u,
+    0xeb1fcbadu, 0x197448aeu, 0x0a24bb5au, 0xf84f3859u, 0x2c855cb2u, 0xdeeedfb1u, 0xcdbe2c45u, 0x3fd5af46u,
+    0x7198540du, 0x83f3d70eu, 0x90a324fau, 0x62c8a7f9u, 0xb602c312u, 0x44694011u, 0x5739b3e5u, 0xa55230e6u,
+    0xfb410cc2u, 0x092a8fc1u, 0x1a7a7c35u, 0xe811ff36u, 0x3cdb9bddu, 0xceb018deu, 0xdde0eb2au, 0x2f8b6829u,
+    0x82f63b78u, 0x709db87bu, 0x63cd4b8fu, 0x91a6c88cu, 0x456cac67u, 0xb7072f64u, 0xa457dc90u, 0x563c5f93u,
+    0x082f63b7u, 0xfa44e0b4u, 0xe9141340u, 0x1b7f9043u, 0xcfb5f4a8u, 0x3dde77abu, 0x2e8e845fu, 0xdce5075cu,
+    0x92a8fc17u, 0x60c37f14u, 0x73938ce0u, 0x81f80fe3u, 0x55326b08u, 0xa759e80bu, 0xb4091bffu, 0x466298fcu,
+    0x1871a4d8u, 0xea1a27dbu, 0xf94ad42fu, 0x0b21572cu, 0xdfeb33c7u, 0x2d80b0c4u, 0x3ed04330u, 0xccbbc033u,
+    0xa24bb5a6u, 0x502036a5u, 0x4370c551u, 0xb11b4652u, 0x65d122b9u, 0x97baa1bau, 0x84ea524eu, 0x7681d14du,
+    0x2892ed69u, 0xdaf96e6au, 0xc9a99d9eu, 0x3bc21e9du, 0xef087a76u, 0x1d63f975u, 0x0e330a81u, 0xfc588982u,
+    0xb21572c9u, 0x407ef1cau, 0x532e023eu, 0xa145813du, 0x758fe5d6u, 0x87e466d5u, 0x94b49521u, 0x66df1622u,
+    0x38cc2a06u, 0xcaa7a905u, 0xd9f75af1u, 0x2b9cd9f2u, 0xff56bd19u, 0x0d3d3e1au, 0x1e6dcdeeu, 0xec064eedu,
+    0xc38d26c4u, 0x31e6a5c7u, 0x22b65633u, 0xd0ddd530u, 0x0417b1dbu, 0xf67c32d8u, 0xe52cc12cu, 0x1747422fu,
+    0x49547e0bu, 0xbb3ffd08u, 0xa86f0efcu, 0x5a048dffu, 0x8ecee914u, 0x7ca56a17u, 0x6ff599e3u, 0x9d9e1ae0u,
+    0xd3d3e1abu, 0x21b862a8u, 0x32e8915cu, 0xc083125fu, 0x144976b4u, 0xe622f5b7u, 0xf5720643u, 0x07198540u,
+    0x590ab964u, 0xab613a67u, 0xb831c993u, 0x4a5a4a90u, 0x9e902e7bu, 0x6cfbad78u, 0x7fab5e8cu, 0x8dc0dd8fu,
+    0xe330a81au, 0x115b2b19u, 0x020bd8edu, 0xf0605beeu, 0x24aa3f05u, 0xd6c1bc06u, 0xc5914ff2u, 0x37faccf1u,
+    0x69e9f0d5u, 0x9b8273d6u, 0x88d28022u, 0x7ab90321u, 0xae7367cau, 0x5c18e4c9u, 0x4f48173du, 0xbd23943eu,
+    0xf36e6f75u, 0x0105ec76u, 0x12551f82u, 0xe03e9c81u, 0x34f4f86au, 0xc69f7b69u, 0xd5cf889du, 0x27a40b9eu,
+    0x79b737bau, 0x8bdcb4b9u, 0x988c474du, 0x6ae7c44eu, 0xbe2da0a5u, 0x4c4623a6u, 0x5f16d052u, 0xad7d5351u,
+};
+static const uint32_t crc32c_lane_shift[2][4][256] = {
+    {
+        {
+            0x00000000u, 0xc2a5b65eu, 0x80a71a4du, 0x4202ac13u, 0x04a2426bu, 0xc607f435u, 0x84055826u, 0x46a0ee78u,
+            0x094484d6u, 0xcbe13288u, 0x89e39e9bu, 0x4b4628c5u, 0x0de6c6bdu, 0xcf4370e3u, 0x8d41dcf0u, 0x4fe46aaeu,
+            0x128909acu, 0xd02cbff2u, 0x922e13e1u, 0x508ba5bfu, 0x162b4bc7u, 0xd48efd99u, 0x968c518au, 0x5429e7d4u,
+            0x1bcd8d7au, 0xd9683b24u, 0x9b6a9737u, 0x59cf2169u, 0x1f6fcf11u, 0xddca794fu, 0x9fc8d55cu, 0x5d6d6302u,
+            0x25121358u, 0xe7b7a506u, 0xa5b50915u, 0x6710bf4bu, 0x21b05133u, 0xe315e76du, 0xa1174b7eu, 0x63b2fd20u,
+            0x2c56978eu, 0xeef321d0u, 0xacf18dc3u, 0x6e543b9du, 0x28f4d5e5u, 0xea5163bbu, 0xa853cfa8u, 0x6af679f6u,
+            0x379b1af4u, 0xf53eacaau, 0xb73c00b9u, 0x7599b6e7u, 0x3339589fu, 0xf19ceec1u, 0xb39e42d2u, 0x713bf48cu,
+            0x3edf9e22u, 0xfc7a287cu, 0xbe78846fu, 0x7cdd3231u, 0x3a7ddc49u, 0xf8d86a17u, 0xbadac604u, 0x787f705au,
+            0x4a2426b0u, 0x888190eeu, 0xca833cfdu, 0x08268aa3u, 0x4e8664dbu, 0x8c23d285u, 0xce217e96u, 0x0c84c8c8u,
+            0x4360a266u, 0x81c51438u, 0xc3c7b82bu, 0x01620e75u, 0x47c2e00du, 0x85675653u, 0xc765fa40u, 0x05c04c1eu,
+            0x58ad2f1cu, 0x9a089942u, 0xd80a3551u, 0x1aaf830fu, 0x5c0f6d77u, 0x9eaadb29u, 0xdca8773au, 0x1e0dc164u,
+            0x51e9abcau, 0x934c1d94u, 0xd14eb187u, 0x13eb07d9u, 0x554be9a1u, 0x97ee5fffu, 0xd5ecf3ecu, 0x174945b2u,
+            0x6f3635e8u, 0xad9383b6u, 0xef912fa5u, 0x2d3499fbu, 0x6b947783u, 0xa931c1ddu, 0xeb336dceu, 0x2996db90u,
+            0x6672b13eu, 0xa4d70760u, 0xe6d5ab73u, 0x24701d2du, 0x62d0f355u, 0xa075450bu, 0xe277e918u, 0x20d25f46u,
+            0x7dbf3c44u, 0xbf1a8a1au, 0xfd182609u, 0x3fbd9057u, 0x791d7e2fu, 0xbbb8c871u, 0xf9ba6462u, 0x3b1fd23cu,
+            0x74fbb892u, 0xb65e0eccu, 0xf45ca2dfu, 0x36f91481u, 0x7059faf9u, 0xb2fc4ca7u, 0xf0fee0b4u, 0x325b56eau,
+            0x94484d60u, 0x56edfb3eu, 0x14ef572du, 0xd64ae173u, 0x90ea0f0bu, 0x524fb955u, 0x104d1546u, 0xd2e8a318u,
+            0x9d0cc9b6u, 0x5fa97fe8u, 0x1dabd3fbu, 0xdf0e65a5u, 0x99ae8bddu, 0x5b0b3d83u, 0x19099190u, 0xdbac27ceu,
+            0x86c144ccu, 0x4464f292u, 0x06665e81u, 0xc4c3e8dfu, 0x826306a7u, 0x40c6b0f9u, 0x02c41ceau, 0xc061aab4u,
+            0x8f85c01au, 0x4d207644u, 0x0f22da57u, 0xcd876c09u, 0x8b278271u, 0x4982342fu, 0x0b80983cu, 0xc9252e62u,
+            0xb15a5e38u, 0x73ffe866u, 0x31fd4475u, 0xf358f22bu, 0xb5f81c53u, 0x775daa0du, 0x355f061eu, 0xf7fab040u,
+            0xb81edaeeu, 0x7abb6cb0u, 0x38b9c0a3u, 0xfa1c76fdu, 0xbcbc9885u, 0x7e192edbu, 0x3c1b82c8u, 0xfebe3496u,
+            0xa3d35794u, 0x6176e1cau, 0x23744dd9u, 0xe1d1fb87u, 0xa77115ffu, 0x65d4a3a1u, 0x27d60fb2u, 0xe573b9ecu,
+            0xaa97d342u, 0x6832651cu, 0x2a30c90fu, 0xe8957f51u, 0xae359129u, 0x6c902777u, 0x2e928b64u, 0xec373d3au,
+            0xde6c6bd0u, 0x1cc9dd8eu, 0x5ecb719du, 0x9c6ec7c3u, 0xdace29bbu, 0x186b9fe5u, 0x5a6933f6u, 0x98cc85a8u,
+            0xd728ef06u, 0x158d5958u, 0x578ff54bu, 0x952a4315u, 0xd38aad6du, 0x112f1b33u, 0x532db720u, 0x9188017eu,
+            0xcce5627cu, 0x0e40d422u, 0x4c427831u, 0x8ee7ce6fu, 0xc8472017u, 0x0ae29649u, 0x48e03a5au, 0x8a458c04u,
+            0xc5a1e6aau, 0x070450f4u, 0x4506fce7u, 0x87a34ab9u, 0xc103a4c1u, 0x03a6129fu, 0x41a4be8cu, 0x830108d2u,
+            0xfb7e7888u, 0x39dbced6u, 0x7bd962c5u, 0xb97cd49bu, 0xffdc3ae3u, 0x3d798cbdu, 0x7f7b20aeu, 0xbdde96f0u,
+            0xf23afc5eu, 0x309f4a00u, 0x729de613u, 0xb038504du, 0xf698be35u, 0x343d086bu, 0x763fa478u, 0xb49a1226u,
+            0xe9f77124u, 0x2b52c77au, 0x69506b69u, 0xabf5dd37u, 0xed55334fu, 0x2ff08511u, 0x6df22902u, 0xaf579f5cu,
+            0xe0b3f5f2u, 0x221643acu, 0x6014efbfu, 0xa2b159e1u, 0xe411b799u, 0x26b401c7u, 0x64b6add4u, 0xa6131b8au,
+        },
+        {
+            0x00000000u, 0x2d7cec31u, 0x5af9d862u, 0x77853453u, 0xb5f3b0c4u, 0x988f5cf5u, 0xef0a68a6u, 0xc2768497u,
+            0x6e0b1779u, 0x4377fb48u, 0x34f2cf1bu, 0x198e232au, 0xdbf8a7bdu, 0xf6844b8cu, 0x81017fdfu, 0xac7d93eeu,
+            0xdc162ef2u, 0xf16ac2c3u, 0x86eff690u, 0xab931aa1u, 0x69e59e36u, 0x44997207u, 0x331c4654u, 0x1e60aa65u,
+            0xb21d398bu, 0x9f61d5bau, 0xe8e4e1e9u, 0xc5980dd8u, 0x07ee894fu, 0x2a92657eu, 0x5d17512du, 0x706bbd1cu,
+            0xbdc02b15u, 0x90bcc724u, 0xe739f377u, 0xca451f46u, 0x08339bd1u, 0x254f77e0u, 0x52ca43b3u, 0x7fb6af82u,
+            0xd3cb3c6cu, 0xfeb7d05du, 0x8932e40eu, 0xa44e083fu, 0x66388ca8u, 0x4b446099u, 0x3cc154cau, 0x11bdb8fbu,
+            0x61d605e7u, 0x4caae9d6u, 0x3b2fdd85u, 0x165331b4u, 0xd425b523u, 0xf9595912u, 0x8edc6d41u, 0xa3a08170u,
+            0x0fdd129eu, 0x22a1feafu, 0x5524cafcu, 0x785826cdu, 0xba2ea25au, 0x97524e6bu, 0xe0d77a38u, 0xcdab9609u,
+            0x7e6c20dbu, 0x5310cceau, 0x2495f8b9u, 0x09e91488u, 0xcb9f901fu, 0xe6e37c2eu, 0x9166487du, 0xbc1aa44cu,
+            0x106737a2u, 0x3d1bdb93u, 0x4a9eefc0u, 0x67e203f1u, 0xa5948766u, 0x88e86b57u, 0xff6d5f04u, 0xd211b335u,
+            0xa27a0e29u, 0x8f06e218u, 0xf883d64bu, 0xd5ff3a7au, 0x1789beedu, 0x3af552dcu, 0x4d70668fu, 0x600c8abeu,
+            0xcc711950u, 0xe10df561u, 0x9688c132u, 0xbbf42d03u, 0x7982a994u, 0x54fe45a5u, 0x237b71f6u, 0x0e079dc7u,
+            0xc3ac0bceu, 0xeed0e7ffu, 0x9955d3acu, 0xb4293f9du, 0x765fbb0au, 0x5b23573bu, 0x2ca66368u, 0x01da8f59u,
+            0xada71cb7u, 0x80dbf086u, 0xf75ec4d5u, 0xda2228e4u, 0x1854ac73u, 0x35284042u, 0x42ad7411u, 0x6fd19820u,
+            0x1fba253cu, 0x32c6c90du, 0x4543fd5eu, 0x683f116fu, 0xaa4995f8u, 0x873579c9u, 0xf0b04d9au, 0xddcca1abu,
+            0x71b13245u, 0x5ccdde74u, 0x2b48ea27u, 0x06340616u, 0xc4428281u, 0xe93e6eb0u, 0x9ebb5ae3u, 0xb3c7b6d2u,
+            0xfcd841b6u, 0xd1a4ad87u, 0xa62199d4u, 0x8b5d75e5u, 0x492bf172u, 0x64571d43u, 0x13d22910u, 0x3eaec521u,
+            0x92d356cfu, 0xbfafbafeu, 0xc82a8eadu, 0xe556629cu, 0x2720e60bu, 0x0a5c0a3au, 0x7dd93e69u, 0x50a5d258u,
+            0x20ce6f44u, 0x0db28375u, 0x7a37b726u, 0x574b5b17u, 0x953ddf80u, 0xb84133b1u, 0xcfc407e2u, 0xe2b8ebd3u,
+            0x4ec5783du, 0x63b9940cu, 0x143ca05fu, 0x39404c6eu, 0xfb36c8f9u, 0xd64a24c8u, 0xa1cf109bu, 0x8cb3fcaau,
+            0x41186aa3u, 0x6c648692u, 0x1be1b2c1u, 0x369d5ef0u, 0xf4ebda67u, 0xd9973656u, 0xae120205u, 0x836eee34u,
+            0x2f137ddau, 0x026f91ebu, 0x75eaa5b8u, 0x58964989u, 0x9ae0cd1eu, 0xb79c212fu, 0xc019157cu, 0xed65f94du,
+            0x9d0e4451u, 0xb072a860u, 0xc7f79c33u, 0xea8b7002u, 0x28fdf495u, 0x058118a4u, 0x72042cf7u, 0x5f78c0c6u,
+            0xf3055328u, 0xde79bf19u, 0xa9fc8b4au, 0x8480677bu, 0x46f6e3ecu, 0x6b8a0fddu, 0x1c0f3b8eu, 0x3173d7bfu,
+            0x82b4616du, 0xafc88d5cu, 0xd84db90fu, 0xf531553eu, 0x3747d1a9u, 0x1a3b3d98u, 0x6dbe09cbu, 0x40c2e5fau,
+            0xecbf7614u, 0xc1c39a25u, 0xb646ae76u, 0x9b3a4247u, 0x594cc6d0u, 0x74302ae1u, 0x03b51eb2u, 0x2ec9f283u,
+            0x5ea24f9fu, 0x73dea3aeu, 0x045b97fdu, 0x29277bccu, 0xeb51ff5bu, 0xc62d136au, 0xb1a82739u, 0x9cd4cb08u,
+            0x30a958e6u, 0x1dd5b4d7u, 0x6a508084u, 0x472c6cb5u, 0x855ae822u, 0xa8260413u, 0xdfa33040u, 0xf2dfdc71u,
+            0x3f744a78u, 0x1208a649u, 0x658d921au, 0x48f17e2bu, 0x8a87fabcu, 0xa7fb168du, 0xd07e22deu, 0xfd02ceefu,
+            0x517f5d01u, 0x7c03b130u, 0x0b868563u, 0x26fa6952u, 0xe48cedc5u, 0xc9f001f4u, 0xbe7535a7u, 0x9309d996u,
+            0xe362648au, 0xce1e88bbu, 0xb99bbce8u, 0x94e750d9u, 0x5691d44eu, 0x7bed387fu, 0x0c680c2cu, 0x2114e01du,
+            0x8d6973f3u, 0xa0159fc2u, 0xd790ab91u, 0xfaec47a0u, 0x389ac337u, 0x15e62f06u, 0x62631b55u, 0x4f1ff764u,
+        },
+        {
+            0x00000000u, 0xfc5cf59du, 0xfd559dcbu, 0x01096856u, 0xff474d67u, 0x031bb8fau, 0x0212d0acu, 0xfe4e2531u,
+            0xfb62ec3fu, 0x073e19a2u, 0x063771f4u, 0xfa6b8469u, 0x0425a158u, 0xf87954c5u, 0xf9703c93u, 0x052cc90eu,
+            0xf329ae8fu, 0x0f755b12u, 0x0e7c3344u, 0xf220c6d9u, 0x0c6ee3e8u, 0xf0321675u, 0xf13b7e23u, 0x0d678bbeu,
+            0x084b42b0u, 0xf417b72du, 0xf51edf7bu, 0x09422ae6u, 0xf70c0fd7u, 0x0b50fa4au, 0x0a59921cu, 0xf6056781u,
+            0xe3bf2befu, 0x1fe3de72u, 0x1eeab624u, 0xe2b643b9u, 0x1cf86688u, 0xe0a49315u, 0xe1adfb43u, 0x1df10edeu,
+            0x18ddc7d0u, 0xe481324du, 0xe5885a1bu, 0x19d4af86u, 0xe79a8ab7u, 0x1bc67f2au, 0x1acf177cu, 0xe693e2e1u,
+            0x10968560u, 0xecca70fdu, 0xedc318abu, 0x119fed36u, 0xefd1c807u, 0x138d3d9au, 0x128455ccu, 0xeed8a051u,
+            0xebf4695fu, 0x17a89cc2u, 0x16a1f494u, 0xeafd0109u, 0x14b32438u, 0xe8efd1a5u, 0xe9e6b9f3u, 0x15ba4c6eu,
+            0xc292212fu, 0x3eced4b2u, 0x3fc7bce4u, 0xc39b4979u, 0x3dd56c48u, 0xc18999d5u, 0xc080f183u, 0x3cdc041eu,
+            0x39f0cd10u, 0xc5ac388du, 0xc4a550dbu, 0x38f9a546u, 0xc6b78077u, 0x3aeb75eau, 0x3be21dbcu, 0xc7bee821u,
+            0x31bb8fa0u, 0xcde77a3du, 0xccee126bu, 0x30b2e7f6u, 0xcefcc2c7u, 0x32a0375au, 0x33a95f0cu, 0xcff5aa91u,
+            0xcad9639fu, 0x36859602u, 0x378cfe54u, 0xcbd00bc9u, 0x359e2ef8u, 0xc9c2db65u, 0xc8cbb333u, 0x349746aeu,
+            0x212d0ac0u, 0xdd71ff5du, 0xdc78970bu, 0x20246296u, 0xde6a47a7u, 0x2236b23au, 0x233fda6cu, 0xdf632ff1u,
+            0xda4fe6ffu, 0x26131362u, 0x271a7b34u, 0xdb468ea9u, 0x2508ab98u, 0xd9545e05u, 0xd85d3653u, 0x2401c3ceu,
+            0xd204a44fu, 0x2e5851d2u, 0x2f513984u, 0xd30dcc19u, 0x2d43e928u, 0xd11f1cb5u, 0xd01674e3u, 0x2c4a817eu,
+            0x29664870u, 0xd53abdedu, 0xd433d5bbu, 0x286f2026u, 0xd6210517u, 0x2a7df08au, 0x2b7498dcu, 0xd7286d41u,
+            0x80c834afu, 0x7c94c132u, 0x7d9da964u, 0x81c15cf9u, 0x7f8f79c8u, 0x83d38c55u, 0x82dae403u, 0x7e86119eu,
+            0x7baad890u, 0x87f62d0du, 0x86ff455bu, 0x7aa3b0c6u, 0x84ed95f7u, 0x78b1606au, 0x79b8083cu, 0x85e4fda1u,
+            0x73e19a20u, 0x8fbd6fbdu, 0x8eb407ebu, 0x72e8f276u, 0x8ca6d747u, 0x70fa22dau, 0x71f34a8cu, 0x8dafbf11u,
+            0x8883761fu, 0x74df8382u, 0x75d6ebd4u, 0x898a1e49u, 0x77c43b78u, 0x8b98cee5u, 0x8a91a6b3u, 0x76cd532eu,
+            0x63771f40u, 0x9f2beaddu, 0x9e22828bu, 0x627e7716u, 0x9c305227u, 0x606ca7bau, 0x6165cfecu, 0x9d393a71u,
+            0x9815f37fu, 0x644906e2u, 0x65406eb4u, 0x991c9b29u, 0x6752be18u, 0x9b0e4b85u, 0x9a0723d3u, 0x665bd64eu,
+            0x905eb1cfu, 0x6c024452u, 0x6d0b2c04u, 0x9157d999u, 0x6f19fca8u, 0x93450935u, 0x924c6163u, 0x6e1094feu,
+            0x6b3c5df0u, 0x9760a86du, 0x9669c03bu, 0x6a3535a6u, 0x947b1097u, 0x6827e50au, 0x692e8d5cu, 0x957278c1u,
+            0x425a1580u, 0xbe06e01du, 0xbf0f884bu, 0x43537dd6u, 0xbd1d58e7u, 0x4141ad7au, 0x4048c52cu, 0xbc1430b1u,
+            0xb938f9bfu, 0x45640c22u, 0x446d6474u, 0xb83191e9u, 0x467fb4d8u, 0xba234145u, 0xbb2a2913u, 0x4776dc8eu,
+            0xb173bb0fu, 0x4d2f4e92u, 0x4c2626c4u, 0xb07ad359u, 0x4e34f668u, 0xb26803f5u, 0xb3616ba3u, 0x4f3d9e3eu,
+            0x4a115730u, 0xb64da2adu, 0xb744cafbu, 0x4b183f66u, 0xb5561a57u, 0x490aefcau, 0x4803879cu, 0xb45f7201u,
+            0xa1e53e6fu, 0x5db9cbf2u, 0x5cb0a3a4u, 0xa0ec5639u, 0x5ea27308u, 0xa2fe8695u, 0xa3f7eec3u, 0x5fab1b5eu,
+            0x5a87d250u, 0xa6db27cdu, 0xa7d24f9bu, 0x5b8eba06u, 0xa5c09f37u, 0x599c6aaau, 0x589502fcu, 0xa4c9f761u,
+            0x52cc90e0u, 0xae90657du, 0xaf990d2bu, 0x53c5f8b6u, 0xad8bdd87u, 0x51d7281au, 0x50de404cu, 0xac82b5d1u,
+            0xa9ae7cdfu, 0x55f28942u, 0x54fbe114u, 0xa8a71489u, 0x56e931b8u, 0xaab5c425u, 0xabbcac73u, 0x57e059eeu,
+        },
+        {
+            0x00000000u, 0x047c1fafu, 0x08f83f5eu, 0x0c8420f1u, 0x11f07ebcu, 0x158c6113u, 0x190841e2u, 0x1d745e4du,
+            0x23e0fd78u, 0x279ce2d7u, 0x2b18c226u, 0x2f64dd89u, 0x321083c4u, 0x366c9c6bu, 0x3ae8bc9au, 0x3e94a335u,
+            0x47c1faf0u, 0x43bde55fu, 0x4f39c5aeu, 0x4b45da01u, 0x5631844cu, 0x524d9be3u, 0x5ec9bb12u, 0x5ab5a4bdu,
+            0x64210788u, 0x605d1827u, 0x6cd938d6u, 0x68a52779u, 0x75d17934u, 0x71ad669bu, 0x7d29466au, 0x795559c5u,
+            0x8f83f5e0u, 0x8bffea4fu, 0x877bcabeu, 0x8307d511u, 0x9e738b5cu, 0x9a0f94f3u, 0x968bb402u, 0x92f7abadu,
+            0xac630898u, 0xa81f1737u, 0xa49b37c6u, 0xa0e72869u, 0xbd937624u, 0xb9ef698bu, 0xb56b497au, 0xb11756d5u,
+            0xc8420f10u, 0xcc3e10bfu, 0xc0ba304eu, 0xc4c62fe1u, 0xd9b271acu, 0xddce6e03u, 0xd14a4ef2u, 0xd536515du,
+            0xeba2f268u, 0xefdeedc7u, 0xe35acd36u, 0xe726d299u, 0xfa528cd4u, 0xfe2e937bu, 0xf2aab38au, 0xf6d6ac25u,
+            0x1aeb9d31u, 0x1e97829eu, 0x1213a26fu, 0x166fbdc0u, 0x0b1be38du, 0x0f67fc22u, 0x03e3dcd3u, 0x079fc37cu,
+            0x390b6049u, 0x3d777fe6u, 0x31f35f17u, 0x358f40b8u, 0x28fb1ef5u, 0x2c87015au, 0x200321abu, 0x247f3e04u,
+            0x5d2a67c1u, 0x5956786eu, 0x55d2589fu, 0x51ae4730u, 0x4cda197du, 0x48a606d2u, 0x44222623u, 0x405e398cu,
+            0x7eca9ab9u, 0x7ab68516u, 0x7632a5e7u, 0x724eba48u, 0x6f3ae405u, 0x6b46fbaau, 0x67c2db5bu, 0x63bec4f4u,
+            0x956868d1u, 0x9114777eu, 0x9d90578fu, 0x99ec4820u, 0x8498166du, 0x80e409c2u, 0x8c602933u, 0x881c369cu,
+            0xb68895a9u, 0xb2f48a06u, 0xbe70aaf7u, 0xba0cb558u, 0xa778eb15u, 0xa304f4bau, 0xaf80d44bu, 0xabfccbe4u,
+            0xd2a99221u, 0xd6d58d8eu, 0xda51ad7fu, 0xde2db2d0u, 0xc359ec9du, 0xc725f332u, 0xcba1d3c3u, 0xcfddcc6cu,
+            0xf1496f59u, 0xf53570f6u, 0xf9b15007u, 0xfdcd4fa8u, 0xe0b911e5u, 0xe4c50e4au, 0xe8412ebbu, 0xec3d3114u,
+            0x35d73a62u, 0x31ab25cdu, 0x3d2f053cu, 0x39531a93u, 0x242744deu, 0x205b5b71u, 0x2cdf7b80u, 0x28a3642fu,
+            0x1637c71au, 0x124bd8b5u, 0x1ecff844u, 0x1ab3e7ebu, 0x07c7b9a6u, 0x03bba609u, 0x0f3f86f8u, 0x0b439957u,
+            0x7216c092u, 0x766adf3du, 0x7aeeffccu, 0x7e92e063u, 0x63e6be2eu, 0x679aa181u, 0x6b1e8170u, 0x6f629edfu,
+            0x51f63deau, 0x558a2245u, 0x590e02b4u, 0x5d721d1bu, 0x40064356u, 0x447a5cf9u, 0x48fe7c08u, 0x4c8263a7u,
+            0xba54cf82u, 0xbe28d02du, 0xb2acf0dcu, 0xb6d0ef73u, 0xaba4b13eu, 0xafd8ae91u, 0xa35c8e60u, 0xa72091cfu,
+            0x99b432fau, 0x9dc82d55u, 0x914c0da4u, 0x9530120bu, 0x88444c46u, 0x8c3853e9u, 0x80bc7318u, 0x84c06cb7u,
+            0xfd953572u, 0xf9e92addu, 0xf56d0a2cu, 0xf1111583u, 0xec654bceu, 0xe8195461u, 0xe49d7490u, 0xe0e16b3fu,
+            0xde75c80au, 0xda09d7a5u, 0xd68df754u, 0xd2f1e8fbu, 0xcf85b6b6u, 0xcbf9a919u, 0xc77d89e8u, 0xc3019647u,
+            0x2f3ca753u, 0x2b40b8fcu, 0x27c4980du, 0x23b887a2u, 0x3eccd9efu, 0x3ab0c640u, 0x3634e6b1u, 0x3248f91eu,
+            0x0cdc5a2bu, 0x08a04584u, 0x04246575u, 0x00587adau, 0x1d2c2497u, 0x19503b38u, 0x15d41bc9u, 0x11a80466u,
+            0x68fd5da3u, 0x6c81420cu, 0x600562fdu, 0x64797d52u, 0x790d231fu, 0x7d713cb0u, 0x71f51c41u, 0x758903eeu,
+            0x4b1da0dbu, 0x4f61bf74u, 0x43e59f85u, 0x4799802au, 0x5aedde67u, 0x5e91c1c8u, 0x5215e139u, 0x5669fe96u,
+            0xa0bf52b3u, 0xa4c34d1cu, 0xa8476dedu, 0xac3b7242u, 0xb14f2c0fu, 0xb53333a0u, 0xb9b71351u, 0xbdcb0cfeu,
+            0x835fafcbu, 0x8723b064u, 0x8ba79095u, 0x8fdb8f3au, 0x92afd177u, 0x96d3ced8u, 0x9a57ee29u, 0x9e2bf186u,
+            0xe77ea843u, 0xe302b7ecu, 0xef86971du, 0xebfa88b2u, 0xf68ed6ffu, 0xf2f2c950u, 0xfe76e9a1u, 0xfa0af60eu,
+            0xc49e553bu, 0xc0e24a94u, 0xcc666a65u, 0xc81a75cau, 0xd56e2b87u, 0xd1123428u, 0xdd9614d9u, 0xd9ea0b76u,
+        },
+    },
+    {
+        {
+            0x00000000u, 0xe040e0acu, 0xc56db7a9u, 0x252d5705u, 0x8f3719a3u, 0x6f77f90fu, 0x4a5aae0au, 0xaa1a4ea6u,
+            0x1b8245b7u, 0xfbc2a51bu, 0xdeeff21eu, 0x3eaf12b2u, 0x94b55c14u, 0x74f5bcb8u, 0x51d8ebbdu, 0xb1980b11u,
+            0x37048b6eu, 0xd7446bc2u, 0xf2693cc7u, 0x1229dc6bu, 0xb83392cdu, 0x58737261u, 0x7d5e2564u, 0x9d1ec5c8u,
+            0x2c86ced9u, 0xccc62e75u, 0xe9eb7970u, 0x09ab99dcu, 0xa3b1d77au, 0x43f137d6u, 0x66dc60d3u, 0x869c807fu,
+            0x6e0916dcu, 0x8e49f670u, 0xab64a175u, 0x4b2441d9u, 0xe13e0f7fu, 0x017eefd3u, 0x2453b8d6u, 0xc413587au,
+            0x758b536bu, 0x95cbb3c7u, 0xb0e6e4c2u, 0x50a6046eu, 0xfabc4ac8u, 0x1afcaa64u, 0x3fd1fd61u, 0xdf911dcdu,
+            0x590d9db2u, 0xb94d7d1eu, 0x9c602a1bu, 0x7c20cab7u, 0xd63a8411u, 0x367a64bdu, 0x135733b8u, 0xf317d314u,
+            0x428fd805u, 0xa2cf38a9u, 0x87e26facu, 0x67a28f00u, 0xcdb8c1a6u, 0x2df8210au, 0x08d5760fu, 0xe89596a3u,
+            0xdc122db8u, 0x3c52cd14u, 0x197f9a11u, 0xf93f7abdu, 0x5325341bu, 0xb365d4b7u, 0x964883b2u, 0x7608631eu,
+            0xc790680fu, 0x27d088a3u, 0x02fddfa6u, 0xe2bd3f0au, 0x48a771acu, 0xa8e79100u, 0x8dcac605u, 0x6d8a26a9u,
+            0xeb16a6d6u, 0x0b56467au, 0x2e7b117fu, 0xce3bf1d3u, 0x6421bf75u, 0x84615fd9u, 0xa14c08dcu, 0x410ce870u,
+            0xf094e361u, 0x10d403cdu, 0x35f954c8u, 0xd5b9b464u, 0x7fa3fac2u, 0x9fe31a6eu, 0xbace4d6bu, 0x5a8eadc7u,
+            0xb21b3b64u, 0x525bdbc8u, 0x77768ccdu, 0x97366c61u, 0x3d2c22c7u, 0xdd6cc26bu, 0xf841956eu, 0x180175c2u,
+            0xa9997ed3u, 0x49d99e7fu, 0x6cf4c97au, 0x8cb429d6u, 0x26ae6770u, 0xc6ee87dcu, 0xe3c3d0d9u, 0x03833075u,
+            0x851fb00au, 0x655f50a6u, 0x407207a3u, 0xa032e70fu, 0x0a28a9a9u, 0xea684905u, 0xcf451e00u, 0x2f05feacu,
+            0x9e9df5bdu, 0x7edd1511u, 0x5bf04214u, 0xbbb0a2b8u, 0x11aaec1eu, 0xf1ea0cb2u, 0xd4c75bb7u, 0x3487bb1bu,
+            0xbdc82d81u, 0x5d88cd2du, 0x78a59a28u, 0x98e57a84u, 0x32ff3422u, 0xd2bfd48eu, 0xf792838bu, 0x17d26327u,
+            0xa64a6836u, 0x460a889au, 0x6327df9fu, 0x83673f33u, 0x297d7195u, 0xc93d9139u, 0xec10c63cu, 0x0c502690u,
+            0x8acca6efu, 0x6a8c4643u, 0x4fa11146u, 0xafe1f1eau, 0x05fbbf4cu, 0xe5bb5fe0u, 0xc09608e5u, 0x20d6e849u,
+            0x914ee358u, 0x710e03f4u, 0x542354f1u, 0xb463b45du, 0x1e79fafbu, 0xfe391a57u, 0xdb144d52u, 0x3b54adfeu,
+            0xd3c13b5du, 0x3381dbf1u, 0x16ac8cf4u, 0xf6ec6c58u, 0x5cf622feu, 0xbcb6c252u, 0x999b9557u, 0x79db75fbu,
+            0xc8437eeau, 0x28039e46u, 0x0d2ec943u, 0xed6e29efu, 0x47746749u, 0xa73487e5u, 0x8219d0e0u, 0x6259304cu,
+            0xe4c5b033u, 0x0485509fu, 0x21a8079au, 0xc1e8e736u, 0x6bf2a990u, 0x8bb2493cu, 0xae9f1e39u, 0x4edffe95u,
+            0xff47f584u, 0x1f071528u, 0x3a2a422du, 0xda6aa281u, 0x7070ec27u, 0x90300c8bu, 0xb51d5b8eu, 0x555dbb22u,
+            0x61da0039u, 0x819ae095u, 0xa4b7b790u, 0x44f7573cu, 0xeeed199au, 0x0eadf936u, 0x2b80ae33u, 0xcbc04e9fu,
+            0x7a58458eu, 0x9a18a522u, 0xbf35f227u, 0x5f75128bu, 0xf56f5c2du, 0x152fbc81u, 0x3002eb84u, 0xd0420b28u,
+            0x56de8b57u, 0xb69e6bfbu, 0x93b33cfeu, 0x73f3dc52u, 0xd9e992f4u, 0x39a97258u, 0x1c84255du, 0xfcc4c5f1u,
+            0x4d5ccee0u, 0xad1c2e4cu, 0x88317949u, 0x687199e5u, 0xc26bd743u, 0x222b37efu, 0x070660eau, 0xe7468046u,
+            0x0fd316e5u, 0xef93f649u, 0xcabea14cu, 0x2afe41e0u, 0x80e40f46u, 0x60a4efeau, 0x4589b8efu, 0xa5c95843u,
+            0x14515352u, 0xf411b3feu, 0xd13ce4fbu, 0x317c0457u, 0x9b664af1u, 0x7b26aa5du, 0x5e0bfd58u, 0xbe4b1df4u,
+            0x38d79d8bu, 0xd8977d27u, 0xfdba2a22u, 0x1dfaca8eu, 0xb7e08428u, 0x57a06484u, 0x728d3381u, 0x92cdd32du,
+            0x2355d83cu, 0xc3153890u, 0xe6386f95u, 0x06788f39u, 0xac62c19fu, 0x4c222133u, 0x690f7636u, 0x894f969au,
+        },
+        {
+            0x00000000u, 0x7e7c2df3u, 0xfcf85be6u, 0x82847615u, 0xfc1cc13du, 0x8260ecceu, 0x00e49adbu, 0x7e98b728u,
+            0xfdd5f48bu, 0x83a9d978u, 0x012daf6du, 0x7f51829eu, 0x01c935b6u, 0x7fb51845u, 0xfd316e50u, 0x834d43a3u,
+            0xfe479fe7u, 0x803bb214u, 0x02bfc401u, 0x7cc3e9f2u, 0x025b5edau, 0x7c277329u, 0xfea3053cu, 0x80df28cfu,
+            0x03926b6cu, 0x7dee469fu, 0xff6a308au, 0x81161d79u, 0xff8eaa51u, 0x81f287a2u, 0x0376f1b7u, 0x7d0adc44u,
+            0xf963493fu, 0x871f64ccu, 0x059b12d9u, 0x7be73f2au, 0x057f8802u, 0x7b03a5f1u, 0xf987d3e4u, 0x87fbfe17u,
+            0x04b6bdb4u, 0x7aca9047u, 0xf84ee652u, 0x8632cba1u, 0xf8aa7c89u, 0x86d6517au, 0x0452276fu, 0x7a2e0a9cu,
+            0x0724d6d8u, 0x7958fb2bu, 0xfbdc8d3eu, 0x85a0a0cdu, 0xfb3817e5u, 0x85443a16u, 0x07c04c03u, 0x79bc61f0u,
+            0xfaf12253u, 0x848d0fa0u, 0x060979b5u, 0x78755446u, 0x06ede36eu, 0x7891ce9du, 0xfa15b888u, 0x8469957bu,
+            0xf72ae48fu, 0x8956c97cu, 0x0bd2bf69u, 0x75ae929au, 0x0b3625b2u, 0x754a0841u, 0xf7ce7e54u, 0x89b253a7u,
+            0x0aff1004u, 0x74833df7u, 0xf6074be2u, 0x887b6611u, 0xf6e3d139u, 0x889ffccau, 0x0a1b8adfu, 0x7467a72cu,
+            0x096d7b68u, 0x7711569bu, 0xf595208eu, 0x8be90d7du, 0xf571ba55u, 0x8b0d97a6u, 0x0989e1b3u, 0x77f5cc40u,
+            0xf4b88fe3u, 0x8ac4a210u, 0x0840d405u, 0x763cf9f6u, 0x08a44edeu, 0x76d8632du, 0xf45c1538u, 0x8a2038cbu,
+            0x0e49adb0u, 0x70358043u, 0xf2b1f656u, 0x8ccddba5u, 0xf2556c8du, 0x8c29417eu, 0x0ead376bu, 0x70d11a98u,
+            0xf39c593bu, 0x8de074c8u, 0x0f6402ddu, 0x71182f2eu, 0x0f809806u, 0x71fcb5f5u, 0xf378c3e0u, 0x8d04ee13u,
+            0xf00e3257u, 0x8e721fa4u, 0x0cf669b1u, 0x728a4442u, 0x0c12f36au, 0x726ede99u, 0xf0eaa88cu, 0x8e96857fu,
+            0x0ddbc6dcu, 0x73a7eb2fu, 0xf1239d3au, 0x8f5fb0c9u, 0xf1c707e1u, 0x8fbb2a12u, 0x0d3f5c07u, 0x734371f4u,
+            0xebb9bfefu, 0x95c5921cu, 0x1741e409u, 0x693dc9fau, 0x17a57ed2u, 0x69d95321u, 0xeb5d2534u, 0x952108c7u,
+            0x166c4b64u, 0x68106697u, 0xea941082u, 0x94e83d71u, 0xea708a59u, 0x940ca7aau, 0x1688d1bfu, 0x68f4fc4cu,
+            0x15fe2008u, 0x6b820dfbu, 0xe9067beeu, 0x977a561du, 0xe9e2e135u, 0x979eccc6u, 0x151abad3u, 0x6b669720u,
+            0xe82bd483u, 0x9657f970u, 0x14d38f65u, 0x6aafa296u, 0x143715beu, 0x6a4b384du, 0xe8cf4e58u, 0x96b363abu,
+            0x12daf6d0u, 0x6ca6db23u, 0xee22ad36u, 0x905e80c5u, 0xeec637edu, 0x90ba1a1eu, 0x123e6c0bu, 0x6c4241f8u,
+            0xef0f025bu, 0x91732fa8u, 0x13f759bdu, 0x6d8b744eu, 0x1313c366u, 0x6d6fee95u, 0xefeb9880u, 0x9197b573u,
+            0xec9d6937u, 0x92e144c4u, 0x106532d1u, 0x6e191f22u, 0x1081a80au, 0x6efd85f9u, 0xec79f3ecu, 0x9205de1fu,
+            0x11489dbcu, 0x6f34b04fu, 0xedb0c65au, 0x93cceba9u, 0xed545c81u, 0x93287172u, 0x11ac0767u, 0x6fd02a94u,
+            0x1c935b60u, 0x62ef7693u, 0xe06b0086u, 0x9e172d75u, 0xe08f9a5du, 0x9ef3b7aeu, 0x1c77c1bbu, 0x620bec48u,
+            0xe146afebu, 0x9f3a8218u, 0x1dbef40du, 0x63c2d9feu, 0x1d5a6ed6u, 0x63264325u, 0xe1a23530u, 0x9fde18c3u,
+            0xe2d4c487u, 0x9ca8e974u, 0x1e2c9f61u, 0x6050b292u, 0x1ec805bau, 0x60b42849u, 0xe2305e5cu, 0x9c4c73afu,
+            0x1f01300cu, 0x617d1dffu, 0xe3f96beau, 0x9d854619u, 0xe31df131u, 0x9d61dcc2u, 0x1fe5aad7u, 0x61998724u,
+            0xe5f0125fu, 0x9b8c3facu, 0x190849b9u, 0x6774644au, 0x19ecd362u, 0x6790fe91u, 0xe5148884u, 0x9b68a577u,
+            0x1825e6d4u, 0x6659cb27u, 0xe4ddbd32u, 0x9aa190c1u, 0xe43927e9u, 0x9a450a1au, 0x18c17c0fu, 0x66bd51fcu,
+            0x1bb78db8u, 0x65cba04bu, 0xe74fd65eu, 0x9933fbadu, 0xe7ab4c85u, 0x99d76176u, 0x1b531763u, 0x652f3a90u,
+            0xe6627933u, 0x981e54c0u, 0x1a9a22d5u, 0x64e60f26u, 0x1a7eb80eu, 0x640295fdu, 0xe686e3e8u, 0x98face1bu,
+        },
+        {
+            0x00000000u, 0xd29f092fu, 0xa0d264afu, 0x724d6d80u, 0x4448bfafu, 0x96d7b680u, 0xe49adb00u, 0x3605d22fu,
+            0x88917f5eu, 0x5a0e7671u, 0x28431bf1u, 0xfadc12deu, 0xccd9c0f1u, 0x1e46c9deu, 0x6c0ba45eu, 0xbe94ad71u,
+            0x14ce884du, 0xc6518162u, 0xb41cece2u, 0x6683e5cdu, 0x508637e2u, 0x82193ecdu, 0xf054534du, 0x22cb5a62u,
+            0x9c5ff713u, 0x4ec0fe3cu, 0x3c8d93bcu, 0xee129a93u, 0xd81748bcu, 0x0a884193u, 0x78c52c13u, 0xaa5a253cu,
+            0x299d109au, 0xfb0219b5u, 0x894f7435u, 0x5bd07d1au, 0x6dd5af35u, 0xbf4aa61au, 0xcd07cb9au, 0x1f98c2b5u,
+            0xa10c6fc4u, 0x739366ebu, 0x01de0b6bu, 0xd3410244u, 0xe544d06bu, 0x37dbd944u, 0x4596b4c4u, 0x9709bdebu,
+            0x3d5398d7u, 0xefcc91f8u, 0x9d81fc78u, 0x4f1ef557u, 0x791b2778u, 0xab842e57u, 0xd9c943d7u, 0x0b564af8u,
+            0xb5c2e789u, 0x675deea6u, 0x15108326u, 0xc78f8a09u, 0xf18a5826u, 0x23155109u, 0x51583c89u, 0x83c735a6u,
+            0x533a2134u, 0x81a5281bu, 0xf3e8459bu, 0x21774cb4u, 0x17729e9bu, 0xc5ed97b4u, 0xb7a0fa34u, 0x653ff31bu,
+            0xdbab5e6au, 0x09345745u, 0x7b793ac5u, 0xa9e633eau, 0x9fe3e1c5u, 0x4d7ce8eau, 0x3f31856au, 0xedae8c45u,
+            0x47f4a979u, 0x956ba056u, 0xe726cdd6u, 0x35b9c4f9u, 0x03bc16d6u, 0xd1231ff9u, 0xa36e7279u, 0x71f17b56u,
+            0xcf65d627u, 0x1dfadf08u, 0x6fb7b288u, 0xbd28bba7u, 0x8b2d6988u, 0x59b260a7u, 0x2bff0d27u, 0xf9600408u,
+            0x7aa731aeu, 0xa8383881u, 0xda755501u, 0x08ea5c2eu, 0x3eef8e01u, 0xec70872eu, 0x9e3deaaeu, 0x4ca2e381u,
+            0xf2364ef0u, 0x20a947dfu, 0x52e42a5fu, 0x807b2370u, 0xb67ef15fu, 0x64e1f870u, 0x16ac95f0u, 0xc4339cdfu,
+            0x6e69b9e3u, 0xbcf6b0ccu, 0xcebbdd4cu, 0x1c24d463u, 0x2a21064cu, 0xf8be0f63u, 0x8af362e3u, 0x586c6bccu,
+            0xe6f8c6bdu, 0x3467cf92u, 0x462aa212u, 0x94b5ab3du, 0xa2b07912u, 0x702f703du, 0x02621dbdu, 0xd0fd1492u,
+            0xa6744268u, 0x74eb4b47u, 0x06a626c7u, 0xd4392fe8u, 0xe23cfdc7u, 0x30a3f4e8u, 0x42ee9968u, 0x90719047u,
+            0x2ee53d36u, 0xfc7a3419u, 0x8e375999u, 0x5ca850b6u, 0x6aad8299u, 0xb8328bb6u, 0xca7fe636u, 0x18e0ef19u,
+            0xb2baca25u, 0x6025c30au, 0x1268ae8au, 0xc0f7a7a5u, 0xf6f2758au, 0x246d7ca5u, 0x56201125u, 0x84bf180au,
+            0x3a2bb57bu, 0xe8b4bc54u, 0x9af9d1d4u, 0x4866d8fbu, 0x7e630ad4u, 0xacfc03fbu, 0xdeb16e7bu, 0x0c2e6754u,
+            0x8fe952f2u, 0x5d765bddu, 0x2f3b365du, 0xfda43f72u, 0xcba1ed5du, 0x193ee472u, 0x6b7389f2u, 0xb9ec80ddu,
+            0x07782dacu, 0xd5e72483u, 0xa7aa4903u, 0x7535402cu, 0x43309203u, 0x91af9b2cu, 0xe3e2f6acu, 0x317dff83u,
+            0x9b27dabfu, 0x49b8d390u, 0x3bf5be10u, 0xe96ab73fu, 0xdf6f6510u, 0x0df06c3fu, 0x7fbd01bfu, 0xad220890u,
+            0x13b6a5e1u, 0xc129acceu, 0xb364c14eu, 0x61fbc861u, 0x57fe1a4eu, 0x85611361u, 0xf72c7ee1u, 0x25b377ceu,
+            0xf54e635cu, 0x27d16a73u, 0x559c07f3u, 0x87030edcu, 0xb106dcf3u, 0x6399d5dcu, 0x11d4b85cu, 0xc34bb173u,
+            0x7ddf1c02u, 0xaf40152du, 0xdd0d78adu, 0x0f927182u, 0x3997a3adu, 0xeb08aa82u, 0x9945c702u, 0x4bdace2du,
+            0xe180eb11u, 0x331fe23eu, 0x41528fbeu, 0x93cd8691u, 0xa5c854beu, 0x77575d91u, 0x051a3011u, 0xd785393eu,
+            0x6911944fu, 0xbb8e9d60u, 0xc9c3f0e0u, 0x1b5cf9cfu, 0x2d592be0u, 0xffc622cfu, 0x8d8b4f4fu, 0x5f144660u,
+            0xdcd373c6u, 0x0e4c7ae9u, 0x7c011769u, 0xae9e1e46u, 0x989bcc69u, 0x4a04c546u, 0x3849a8c6u, 0xead6a1e9u,
+            0x54420c98u, 0x86dd05b7u, 0xf4906837u, 0x260f6118u, 0x100ab337u, 0xc295ba18u, 0xb0d8d798u, 0x6247deb7u,
+            0xc81dfb8bu, 0x1a82f2a4u, 0x68cf9f24u, 0xba50960bu, 0x8c554424u, 0x5eca4d0bu, 0x2c87208bu, 0xfe1829a4u,
+            0x408c84d5u, 0x92138dfau, 0xe05ee07au, 0x32c1e955u, 0x04c43b7au, 0xd65b3255u, 0xa4165fd5u, 0x768956fau,
+        },
+        {
+            0x00000000u, 0x4904f221u, 0x9209e442u, 0xdb0d1663u, 0x21ffbe75u, 0x68fb4c54u, 0xb3f65a37u, 0xfaf2a816u,
+            0x43ff7ceau, 0x0afb8ecbu, 0xd1f698a8u, 0x98f26a89u, 0x6200c29fu, 0x2b0430beu, 0xf00926ddu, 0xb90dd4fcu,
+            0x87fef9d4u, 0xcefa0bf5u, 0x15f71d96u, 0x5cf3efb7u, 0xa60147a1u, 0xef05b580u, 0x3408a3e3u, 0x7d0c51c2u,
+            0xc401853eu, 0x8d05771fu, 0x5608617cu, 0x1f0c935du, 0xe5fe3b4bu, 0xacfac96au, 0x77f7df09u, 0x3ef32d28u,
+            0x0a118559u, 0x43157778u, 0x9818611bu, 0xd11c933au, 0x2bee3b2cu, 0x62eac90du, 0xb9e7df6eu, 0xf0e32d4fu,
+            0x49eef9b3u, 0x00ea0b92u, 0xdbe71df1u, 0x92e3efd0u, 0x681147c6u, 0x2115b5e7u, 0xfa18a384u, 0xb31c51a5u,
+            0x8def7c8du, 0xc4eb8eacu, 0x1fe698cfu, 0x56e26aeeu, 0xac10c2f8u, 0xe51430d9u, 0x3e1926bau, 0x771dd49bu,
+            0xce100067u, 0x8714f246u, 0x5c19e425u, 0x151d1604u, 0xefefbe12u, 0xa6eb4c33u, 0x7de65a50u, 0x34e2a871u,
+            0x14230ab2u, 0x5d27f893u, 0x862aeef0u, 0xcf2e1cd1u, 0x35dcb4c7u, 0x7cd846e6u, 0xa7d55085u, 0xeed1a2a4u,
+            0x57dc7658u, 0x1ed88479u, 0xc5d5921au, 0x8cd1603bu, 0x7623c82du, 0x3f273a0cu, 0xe42a2c6fu, 0xad2ede4eu,
+            0x93ddf366u, 0xdad90147u, 0x01d41724u, 0x48d0e505u, 0xb2224d13u, 0xfb26bf32u, 0x202ba951u, 0x692f5b70u,
+            0xd0228f8cu, 0x99267dadu, 0x422b6bceu, 0x0b2f99efu, 0xf1dd31f9u, 0xb8d9c3d8u, 0x63d4d5bbu, 0x2ad0279au,
+            0x1e328febu, 0x57367dcau, 0x8c3b6ba9u, 0xc53f9988u, 0x3fcd319eu, 0x76c9c3bfu, 0xadc4d5dcu, 0xe4c027fdu,
+            0x5dcdf301u, 0x14c90120u, 0xcfc41743u, 0x86c0e562u, 0x7c324d74u, 0x3536bf55u, 0xee3ba936u, 0xa73f5b17u,
+            0x99cc763fu, 0xd0c8841eu, 0x0bc5927du, 0x42c1605cu, 0xb833c84au, 0xf1373a6bu, 0x2a3a2c08u, 0x633ede29u,
+            0xda330ad5u, 0x9337f8f4u, 0x483aee97u, 0x013e1cb6u, 0xfbccb4a0u, 0xb2c84681u, 0x69c550e2u, 0x20c1a2c3u,
+            0x28461564u, 0x6142e745u, 0xba4ff126u, 0xf34b0307u, 0x09b9ab11u, 0x40bd5930u, 0x9bb04f53u, 0xd2b4bd72u,
+            0x6bb9698eu, 0x22bd9bafu, 0xf9b08dccu, 0xb0b47fedu, 0x4a46d7fbu, 0x034225dau, 0xd84f33b9u, 0x914bc198u,
+            0xafb8ecb0u, 0xe6bc1e91u, 0x3db108f2u, 0x74b5fad3u, 0x8e4752c5u, 0xc743a0e4u, 0x1c4eb687u, 0x554a44a6u,
+            0xec47905au, 0xa543627bu, 0x7e4e7418u, 0x374a8639u, 0xcdb82e2fu, 0x84bcdc0eu, 0x5fb1ca6du, 0x16b5384cu,
+            0x2257903du, 0x6b53621cu, 0xb05e747fu, 0xf95a865eu, 0x03a82e48u, 0x4aacdc69u, 0x91a1ca0au, 0xd8a5382bu,
+            0x61a8ecd7u, 0x28ac1ef6u, 0xf3a10895u, 0xbaa5fab4u, 0x405752a2u, 0x0953a083u, 0xd25eb6e0u, 0x9b5a44c1u,
+            0xa5a969e9u, 0xecad9bc8u, 0x37a08dabu, 0x7ea47f8au, 0x8456d79cu, 0xcd5225bdu, 0x165f33deu, 0x5f5bc1ffu,
+            0xe6561503u, 0xaf52e722u, 0x745ff141u, 0x3d5b0360u, 0xc7a9ab76u, 0x8ead5957u, 0x55a04f34u, 0x1ca4bd15u,
+            0x3c651fd6u, 0x7561edf7u, 0xae6cfb94u, 0xe76809b5u, 0x1d9aa1a3u, 0x549e5382u, 0x8f9345e1u, 0xc697b7c0u,
+            0x7f9a633cu, 0x369e911du, 0xed93877eu, 0xa497755fu, 0x5e65dd49u, 0x17612f68u, 0xcc6c390bu, 0x8568cb2au,
+            0xbb9be602u, 0xf29f1423u, 0x29920240u, 0x6096f061u, 0x9a645877u, 0xd360aa56u, 0x086dbc35u, 0x41694e14u,
+            0xf8649ae8u, 0xb16068c9u, 0x6a6d7eaau, 0x23698c8bu, 0xd99b249du, 0x909fd6bcu, 0x4b92c0dfu, 0x029632feu,
+            0x36749a8fu, 0x7f7068aeu, 0xa47d7ecdu, 0xed798cecu, 0x178b24fau, 0x5e8fd6dbu, 0x8582c0b8u, 0xcc863299u,
+            0x758be665u, 0x3c8f1444u, 0xe7820227u, 0xae86f006u, 0x54745810u, 0x1d70aa31u, 0xc67dbc52u, 0x8f794e73u,
+            0xb18a635bu, 0xf88e917au, 0x23838719u, 0x6a877538u, 0x9075dd2eu, 0xd9712f0fu, 0x027c396cu, 0x4b78cb4du,
+            0xf2751fb1u, 0xbb71ed90u, 0x607cfbf3u, 0x297809d2u, 0xd38aa1c4u, 0x9a8e53e5u, 0x41834586u, 0x0887b7a7u,
+        },
+    },
+};
+
+#endif
@@ -0,0 +1,82 @@
+// Writes crc_tables.h to stdout:
+//   cc -o crc_gen cksum/gen/crc_gen.c && ./crc_gen > cksum/crc_tables.h
+// As const data the tables sit in the binary's read-only pages instead of
+// being computed at every start.
+#include <stdint.h>
+#include <stdio.h>
+
+#define LANE 4096u // must match CKSUM_LANE in cksum.c
+
+static uint32_t r_multmodp(uint32_t poly, uint32_t a, uint32_t b) {
+    uint32_t p = 0u;
+    for (int i = 0; i < 32; ++i) {
+        if (a & (0x80000000u >> i)) p ^= b;
+        b = (b & 1u) ? (b >> 1) ^ poly : b >> 1;
+    }
+    return p;
+}
+
+static uint32_t r_x8nmodp(uint32_t poly, unsigned long long len) {
+    uint32_t p = 0x80000000u;
+    uint32_t sq = 0x00800000u;
+    while (len != 0ull) {
+        if (len & 1ull) p = r_multmodp(poly, p, sq);
+        sq = r_multmodp(poly, sq, sq);
+        len >>= 1;
+    }
+    return p;
+}
+
+static void put_row(const uint32_t *v, const char *indent) {
+    for (int i = 0; i < 256; ++i) {
+        if (i % 8 == 0) printf("%s", indent);
+        printf("0x%08xu,%s", v[i], i % 8 == 7 ? "\n" : " ");
+    }
+}
+
+static void put_reflected(const char *name, uint32_t poly) {
+    uint32_t t[256];
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int j = 0; j < 8; ++j) crc = (crc & 1u) ? (crc >> 1) ^ poly : crc >> 1;
+        t[i] = crc;
+    }
+    printf("static const uint32_t %s_table[256] = {\n", name);
+    put_row(t, "    ");
+    printf("};\n");
+    printf("static const uint32_t %s_lane_shift[2][4][256] = {\n", name);
+    for (int s = 0; s < 2; ++s) {
+        uint32_t k = r_x8nmodp(poly, (unsigned long long)LANE * (unsigned)(s + 1));
+        printf("    {\n");
+        for (int byte = 0; byte < 4; ++byte) {
+            for (uint32_t i = 0; i < 256; ++i) t[i] = r_multmodp(poly, i << (8 * byte), k);
+            printf("        {\n");
+            put_row(t, "            ");
+            printf("        },\n");
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+}
+
+int main(void) {
+    uint32_t t[256];
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i << 24;
+        for (int j = 0; j < 8; ++j) crc = (crc & 0x80000000u) ? (crc << 1) ^ 0x04C11DB7u : crc << 1;
+        t[i] = crc;
+    }
+    printf("// Generated by cksum/gen/crc_gen.c, do not edit.\n");
+    printf("#ifndef CKSUM_CRC_TABLES_H\n#define CKSUM_CRC_TABLES_H\n#include <stdint.h>\n\n");
+    printf("#define CRC_TABLES_LANE %uu\n\n", LANE);
+    printf("// POSIX cksum, MSB-first, polynomial 0x04C11DB7\n");
+    printf("static const uint32_t crc32_table[256] = {\n");
+    put_row(t, "    ");
+    printf("};\n\n");
+    printf("// crc32b (zlib), reflected polynomial 0xEDB88320\n");
+    put_reflected("crc32b", 0xEDB88320u);
+    printf("\n// crc32c (Castagnoli), reflected polynomial 0x82F63B78\n");
+    put_reflected("crc32c", 0x82F63B78u);
+    printf("\n#endif\n");
+    return ferror(stdout) ? 1 : 0;
+}
@@ -1,26 +1,139 @@
 #include "cksum.h"
+#include "cache.h"
+#include "../common/stats.h"
 #include <fcntl.h>
+#include <getopt.h>
+#include <string.h>
 #include <unistd.h>
 
-int main(int argc, char **argv) {
-    init_crc32_table();
-    if (argc <= 1) {
-        int ret = cksum_stream(STDIN_FILENO, NULL);
-        return ret == 0 ? 0 : 1;    
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [-a crc|crc32b|crc32c] [-C cachefile] [--count] [file ...]\n", prog);
+    fprintf(stderr, "       %s [-a crc|crc32b|crc32c] [-C cachefile] -c manifest\n", prog);
+}
+
+static void print_result(const char *path, const cksum_result_t *r, void *ctx) {
+    int *exit_code = (int *)ctx;
+    if (r->error != 0) {
+        fprintf(stderr, "cksum: %s: %s\n", path, strerror(r->error));
+        *exit_code = 1;
+        return;
+    }
+    if (path) printf("%u %llu %s\n", r->crc, r->total, path);
+    else printf("%u %llu\n", r->crc, r->total);
+}
+
+// --count: "CRC SIZE LINES WORDS NAME"
+static void print_counted(const char *path, const cksum_result_t *r, void *ctx) {
+    int *exit_code = (int *)ctx;
+    if (r->error != 0) {
+        fprintf(stderr, "cksum: %s: %s\n", path, strerror(r->error));
+        *exit_code = 1;
+        return;
+    }
+    if (path) printf("%u %llu %zu %zu %s\n", r->crc, r->total, r->lines, r->words, path);
+    else printf("%u %llu %zu %zu\n", r->crc, r->total, r->lines, r->words);
+}
+
+static void print_check(const char *path, cksum_check_status_t status, const cksum_result_t *r, void *ctx) {
+    (void)ctx;
+    if (status == CKSUM_CHECK_OK) {
+        printf("%s: OK\n", path);
+        return;
+    }
+    if (status == CKSUM_CHECK_UNREADABLE) {
+        fprintf(stderr, "cksum: %s: %s\n", path, strerror(r->error));
+        printf("%s: FAILED open or read\n", path);
+    } else {
+        printf("%s: FAILED\n", path);
+    }
+    fflush(stdout);
+}
+
+static int run_check(const char *manifest_path, const cksum_options_t *opt) {
+    FILE *manifest = stdin;
+    if (strcmp(manifest_path, "-") != 0) {
+        manifest = fopen(manifest_path, "r");
+        if (!manifest) {
+            perror("cksum: open manifest");
+            return 1;
+        }
+    }
+    cksum_check_summary_t sum;
+    int ret = cksum_check(manifest, opt, print_check, NULL, &sum);
+    if (manifest != stdin) fclose(manifest);
+    if (sum.malformed) fprintf(stderr, "cksum: WARNING: %zu line(s) improperly formatted\n", sum.malformed);
+    if (sum.unreadable) fprintf(stderr, "cksum: WARNING: %zu listed file(s) could not be read\n", sum.unreadable);
+    if (sum.failed) fprintf(stderr, "cksum: WARNING: %zu computed checksum(s) did NOT match\n", sum.failed);
+    return (ret != 0 || sum.failed || sum.unreadable || sum.malformed) ? 1 : 0;
+}
+
+enum { OPT_COUNT = 256 };
+
+int cksum_main(int argc, char **argv) {
+    static const struct option long_opts[] = {
+        { "algorithm", required_argument, NULL, 'a' },
+        { "cache",     required_argument, NULL, 'C' },
+        { "check",     required_argument, NULL, 'c' },
+        { "count",     no_argument,       NULL, OPT_COUNT },
+        { NULL, 0, NULL, 0 }
+    };
+    cksum_options_t opt = { .algo = CKSUM_ALGO_CRC, .workers = 0, .cache = NULL };
+    const char *cache_path = NULL;
+    const char *manifest_path = NULL;
+    stats_init("cksum", &argc, argv);
+    int c;
+    while ((c = getopt_long(argc, argv, "a:C:c:", long_opts, NULL)) != -1) {
+        switch (c) {
+            case 'a':
+                if (cksum_algo_from_name(optarg, &opt.algo) != 0) {
+                    fprintf(stderr, "cksum: unknown algorithm '%s'\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'C': cache_path = optarg; break;
+            case 'c': manifest_path = optarg; break;
+            case OPT_COUNT: opt.count = 1; break;
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
     }
     int exit_code = 0;
-    for (int i = 1; i < argc; ++i) {
-        const char *path = argv[i];
-        int fd = open(path, O_RDONLY);
-        if (fd < 0) {
-            perror("cksum: open file");
-            exit_code = 1;
-            continue;
+    if (manifest_path && (optind < argc || opt.count)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (!manifest_path && optind >= argc) {
+        cksum_result_t r;
+        int rc = opt.count ? cksum_fd_count(STDIN_FILENO, opt.algo, &r) : cksum_fd(STDIN_FILENO, opt.algo, 0, &r);
+        if (rc != 0) {
+            fprintf(stderr, "cksum: read error: %s\n", strerror(r.error));
+            return 1;
         }
-        if (cksum_stream(fd, path) != 0) {
-            exit_code = 1;
+        (opt.count ? print_counted : print_result)(NULL, &r, &exit_code);
+        return exit_code;
+    }
+    if (cache_path) {
+        opt.cache = cksum_cache_open(cache_path);
+        if (!opt.cache) {
+            perror("cksum: cache");
+            return 1;
         }
-        close(fd);
     }
+    stats_phase("checksum");
+    if (manifest_path) {
+        exit_code = run_check(manifest_path, &opt);
+    } else if (cksum_paths((const char *const *)(argv + optind), (size_t)(argc - optind), &opt,
+                           opt.count ? print_counted : print_result, &exit_code) != 0) {
+        exit_code = 1;
+    }
+    if (opt.cache) stats_phase("cache_write");
+    if (cksum_cache_close(opt.cache) != 0) exit_code = 1;
     return exit_code;
 }
+
+#ifndef UNIXC_MULTICALL
+int main(int argc, char **argv) {
+    return cksum_main(argc, argv);
+}
+#endif
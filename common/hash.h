@@ -0,0 +1,23 @@
+#ifndef COMMON_HASH_H
+#define COMMON_HASH_H
+#include <stdint.h>
+
+// splitmix64 finalizer: cheap, and every input bit reaches every output bit.
+static inline uint64_t hash_mix64(uint64_t x) {
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27; x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+// Folds one more field into a running hash.
+static inline uint64_t hash_fold(uint64_t h, uint64_t v) {
+    return hash_mix64(h ^ v);
+}
+
+// Table position for a file identity; (dev, ino) pairs are dense in ino.
+static inline uint64_t hash_inode(uint64_t dev, uint64_t ino) {
+    return hash_fold(hash_mix64(dev), ino);
+}
+
+#endif
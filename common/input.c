@@ -0,0 +1,310 @@
+#include "input.h"
+#include "stats.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define INPUT_BUF_ALIGN 4096
+#define INPUT_POOL_MAX 16
+#define INPUT_WAKE_SIG SIGURG   // ignored by default, so a late one is harmless
+#define INPUT_WAKE_NS 10000000  // resend period while the reader has not left
+
+static unsigned char *pool[INPUT_POOL_MAX];
+static size_t pool_count;
+static pthread_mutex_t pool_mu = PTHREAD_MUTEX_INITIALIZER;
+
+unsigned char *input_buf_get(void) {
+    unsigned char *buf = NULL;
+    pthread_mutex_lock(&pool_mu);
+    if (pool_count > 0) buf = pool[--pool_count];
+    pthread_mutex_unlock(&pool_mu);
+    if (buf) return buf;
+    void *p;
+    if (posix_memalign(&p, INPUT_BUF_ALIGN, INPUT_BUF_SIZE) != 0) return NULL;
+    return (unsigned char *)p;
+}
+
+void input_buf_put(unsigned char *buf) {
+    if (!buf) return;
+    pthread_mutex_lock(&pool_mu);
+    if (pool_count < INPUT_POOL_MAX) {
+        pool[pool_count++] = buf;
+        buf = NULL;
+    }
+    pthread_mutex_unlock(&pool_mu);
+    free(buf);
+}
+
+// The reader thread fills buffers in ring order while the caller works on
+// the one it was handed last, so a slow device and the consumer overlap.
+struct input_pipeline {
+    int fd;
+    unsigned char *buf[INPUT_PIPE_BUFS];
+    size_t len[INPUT_PIPE_BUFS];
+    int full[INPUT_PIPE_BUFS];
+    int eof;        // no buffer after the full ones will be filled
+    int error;      // errno of the failed read
+    int stop;       // consumer gave up; atomic, the reader checks it after EINTR
+    int done;       // reader returned
+    size_t cur;     // consumer's slot
+    int held;       // cur was handed out and is released by the next call
+    pthread_t th;
+    pthread_mutex_t mu;
+    pthread_cond_t cv;
+};
+
+static void wake_handler(int sig) {
+    (void)sig;
+}
+
+static pthread_once_t wake_once = PTHREAD_ONCE_INIT;
+
+// No SA_RESTART: a read(2) on an idle pipe or tty returns EINTR, so a
+// consumer that stops early does not wait for the writer.
+static void wake_install(void) {
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = wake_handler;
+    sigemptyset(&sa.sa_mask);
+    sigaction(INPUT_WAKE_SIG, &sa, NULL);
+}
+
+static void *pipeline_reader(void *argp) {
+    struct input_pipeline *pl = (struct input_pipeline *)argp;
+    for (size_t i = 0;; i = (i + 1) % INPUT_PIPE_BUFS) {
+        pthread_mutex_lock(&pl->mu);
+        while (pl->full[i] && !pl->stop) pthread_cond_wait(&pl->cv, &pl->mu);
+        int stop = pl->stop;
+        pthread_mutex_unlock(&pl->mu);
+        if (stop) break;
+
+        ssize_t n;
+        for (;;) {
+            n = read(pl->fd, pl->buf[i], INPUT_BUF_SIZE);
+            stats_add(STATS_SYS_READ, 1);
+            if (n >= 0 || errno != EINTR || __atomic_load_n(&pl->stop, __ATOMIC_ACQUIRE)) break;
+        }
+        if (n > 0) stats_add(STATS_BYTES_READ, (uint64_t)n);
+
+        pthread_mutex_lock(&pl->mu);
+        if (n > 0) {
+            pl->len[i] = (size_t)n;
+            pl->full[i] = 1;
+        } else {
+            pl->eof = 1;
+            if (n < 0) pl->error = errno;
+        }
+        pthread_cond_broadcast(&pl->cv);
+        pthread_mutex_unlock(&pl->mu);
+        if (n <= 0) break;
+    }
+    pthread_mutex_lock(&pl->mu);
+    pl->done = 1;
+    pthread_cond_broadcast(&pl->cv);
+    pthread_mutex_unlock(&pl->mu);
+    return NULL;
+}
+
+static void pipeline_free(struct input_pipeline *pl) {
+    for (int i = 0; i < INPUT_PIPE_BUFS; ++i) input_buf_put(pl->buf[i]);
+    free(pl);
+}
+
+static int pipeline_start(input_t *in) {
+    struct input_pipeline *pl = (struct input_pipeline *)calloc(1, sizeof(*pl));
+    if (!pl) return -1;
+    pl->fd = in->fd;
+    for (int i = 0; i < INPUT_PIPE_BUFS; ++i) {
+        pl->buf[i] = input_buf_get();
+        if (!pl->buf[i]) {
+            pipeline_free(pl);
+            return -1;
+        }
+    }
+    pthread_once(&wake_once, wake_install);
+    pthread_mutex_init(&pl->mu, NULL);
+    pthread_cond_init(&pl->cv, NULL);
+    if (pthread_create(&pl->th, NULL, pipeline_reader, pl) != 0) {
+        pthread_cond_destroy(&pl->cv);
+        pthread_mutex_destroy(&pl->mu);
+        pipeline_free(pl);
+        return -1;
+    }
+    in->pl = pl;
+    return 0;
+}
+
+static ssize_t pipeline_next(input_t *in, const unsigned char **data) {
+    struct input_pipeline *pl = in->pl;
+    pthread_mutex_lock(&pl->mu);
+    if (pl->held) {
+        pl->full[pl->cur] = 0;
+        pl->held = 0;
+        pl->cur = (pl->cur + 1) % INPUT_PIPE_BUFS;
+        pthread_cond_broadcast(&pl->cv);
+    }
+    while (!pl->full[pl->cur] && !pl->eof) pthread_cond_wait(&pl->cv, &pl->mu);
+    if (!pl->full[pl->cur]) {
+        int error = pl->error;
+        pthread_mutex_unlock(&pl->mu);
+        if (error == 0) return 0;
+        in->error = error;
+        return -1;
+    }
+    pl->held = 1;
+    size_t len = pl->len[pl->cur];
+    *data = pl->buf[pl->cur];
+    pthread_mutex_unlock(&pl->mu);
+    return (ssize_t)len;
+}
+
+// The reader may sit in read(2) until the writer sends more or closes, so
+// it is signalled until it has left; one signal could land just before
+// the read and be lost.
+static void pipeline_stop(struct input_pipeline *pl) {
+    pthread_mutex_lock(&pl->mu);
+    __atomic_store_n(&pl->stop, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&pl->cv);
+    while (!pl->done) {
+        pthread_kill(pl->th, INPUT_WAKE_SIG);
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += INPUT_WAKE_NS;
+        if (ts.tv_nsec >= 1000000000L) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_timedwait(&pl->cv, &pl->mu, &ts);
+    }
+    pthread_mutex_unlock(&pl->mu);
+    pthread_join(pl->th, NULL);
+    pthread_cond_destroy(&pl->cv);
+    pthread_mutex_destroy(&pl->mu);
+    pipeline_free(pl);
+}
+
+// A regular file is read up to the size it had at open, like the mmap
+// backend, so data appended meanwhile (cat f >> f) is not read back.
+static ssize_t read_next(input_t *in, const unsigned char **data) {
+    size_t want = INPUT_BUF_SIZE;
+    if (in->regular) {
+        if (in->pos >= in->end) return 0;
+        if ((off_t)want > in->end - in->pos) want = (size_t)(in->end - in->pos);
+    }
+    for (;;) {
+        ssize_t n = read(in->fd, in->buf, want);
+        stats_add(STATS_SYS_READ, 1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            in->error = errno;
+            return -1;
+        }
+        if (in->regular) in->pos += n;
+        stats_add(STATS_BYTES_READ, (uint64_t)n);
+        *data = in->buf;
+        return n;
+    }
+}
+
+// Maps the next window, page-aligned below pos. If mapping fails part way
+// the rest of the file is read instead.
+static ssize_t mmap_next(input_t *in, const unsigned char **data) {
+    if (in->map) {
+        munmap(in->map, in->map_len);
+        in->map = NULL;
+    }
+    if (in->pos >= in->end) return 0;
+    off_t page = (off_t)sysconf(_SC_PAGESIZE);
+    off_t base = in->pos - in->pos % page;
+    size_t skip = (size_t)(in->pos - base);
+    size_t len = (size_t)(in->end - in->pos);
+    if (len > INPUT_MAP_WINDOW) len = INPUT_MAP_WINDOW;
+    void *map = mmap(NULL, len + skip, PROT_READ, MAP_PRIVATE, in->fd, base);
+    stats_add(STATS_SYS_MMAP, 1);
+    if (map == MAP_FAILED) {
+        in->buf = input_buf_get();
+        if (!in->buf || lseek(in->fd, in->pos, SEEK_SET) < 0) {
+            in->error = in->buf ? errno : ENOMEM;
+            return -1;
+        }
+        in->backend = INPUT_READ;
+        stats_engine("input", "mmap_fallback");
+        return read_next(in, data);
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise(map, len + skip, MADV_SEQUENTIAL);
+#endif
+    in->map = (unsigned char *)map;
+    in->map_len = len + skip;
+    in->pos += (off_t)len;
+    stats_add(STATS_BYTES_READ, len);
+    *data = in->map + skip;
+    return (ssize_t)len;
+}
+
+int input_open(input_t *in, int fd, input_backend_t backend) {
+    memset(in, 0, sizeof(*in));
+    in->fd = fd;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        off_t begin = lseek(fd, 0, SEEK_CUR);
+        if (begin >= 0) {
+            in->regular = 1;
+            in->pos = begin;
+            in->end = st.st_size > begin ? st.st_size : begin;
+            in->size = (unsigned long long)(in->end - begin);
+        }
+    }
+    if (backend == INPUT_AUTO || backend == INPUT_NOMAP) {
+        // Pipes and devices have unknown length, so they always get the pipeline.
+        if (!in->regular) backend = INPUT_PIPELINE;
+        else if (backend == INPUT_AUTO && in->size >= INPUT_MMAP_MIN) backend = INPUT_MMAP;
+        else backend = INPUT_READ;
+    }
+    if (backend == INPUT_MMAP && !in->regular) backend = INPUT_READ;
+#ifdef POSIX_FADV_SEQUENTIAL
+    if (in->regular && backend != INPUT_MMAP) posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    if (backend == INPUT_PIPELINE && pipeline_start(in) != 0) backend = INPUT_READ;
+    if (backend == INPUT_READ) {
+        in->buf = input_buf_get();
+        if (!in->buf) {
+            errno = ENOMEM;
+            return -1;
+        }
+    }
+    in->backend = backend;
+    stats_engine("input", input_backend_name(backend));
+    return 0;
+}
+
+ssize_t input_next(input_t *in, const unsigned char **data) {
+    switch (in->backend) {
+        case INPUT_MMAP: return mmap_next(in, data);
+        case INPUT_PIPELINE: return pipeline_next(in, data);
+        default: return read_next(in, data);
+    }
+}
+
+void input_close(input_t *in) {
+    if (in->map) munmap(in->map, in->map_len);
+    if (in->backend == INPUT_MMAP) lseek(in->fd, in->pos, SEEK_SET);
+    if (in->pl) pipeline_stop(in->pl);
+    input_buf_put(in->buf);
+    in->map = NULL;
+    in->pl = NULL;
+    in->buf = NULL;
+}
+
+const char *input_backend_name(input_backend_t backend) {
+    static const char *const names[] = { "auto", "mmap", "read", "pipeline", "nomap" };
+    return (unsigned)backend < sizeof(names) / sizeof(names[0]) ? names[backend] : "?";
+}
@@ -0,0 +1,58 @@
+#ifndef COMMON_INPUT_H
+#define COMMON_INPUT_H
+#include <stddef.h>
+#include <sys/types.h>
+
+// Sequential block reader shared by wc, cat and cksum. input_next hands out
+// the file in order as blocks that stay valid until the following call;
+// the backend behind it is picked from the file type and size.
+//
+// A mapped file that is truncated while it is read (a rotated log, say)
+// kills the process with SIGBUS when the missing pages are touched, where
+// read(2) would just return less. Callers that read files which may
+// change under them use INPUT_NOMAP.
+typedef enum input_backend {
+    INPUT_AUTO = 0, // mmap for regular files of INPUT_MMAP_MIN or more
+    INPUT_MMAP,     // regular files: read-only windows, no copy
+    INPUT_READ,     // one pooled buffer refilled by read(2)
+    INPUT_PIPELINE, // reader thread keeping INPUT_PIPE_BUFS buffers in flight
+    INPUT_NOMAP     // INPUT_AUTO without mmap: regular files are read
+} input_backend_t;
+
+#define INPUT_BUF_SIZE (1u << 20)       // pooled buffers, page aligned
+#define INPUT_PIPE_BUFS 3
+#define INPUT_MMAP_MIN (64u << 10)      // smaller regular files are read
+#define INPUT_MAP_WINDOW (64ull << 20)
+
+struct input_pipeline;
+
+typedef struct input {
+    int fd;
+    input_backend_t backend;
+    int error;                  // errno once input_next returned -1
+    int regular;
+    unsigned long long size;    // regular files: bytes from the starting offset to EOF
+    off_t pos;                  // regular files: offset of the next block
+    off_t end;                  // regular files: EOF as seen at open, reading stops there
+    unsigned char *map;         // current window
+    size_t map_len;
+    unsigned char *buf;         // INPUT_READ
+    struct input_pipeline *pl;  // INPUT_PIPELINE
+} input_t;
+
+// Starts reading fd at its current offset; INPUT_AUTO chooses the backend
+// and anything that cannot start falls back to INPUT_READ. The fd is not
+// closed. Returns -1 with errno set if no buffer could be had.
+int input_open(input_t *in, int fd, input_backend_t backend);
+// Points *data at the next block and returns its length, 0 at EOF, or -1.
+ssize_t input_next(input_t *in, const unsigned char **data);
+// Releases buffers and mappings; a regular file's offset is left after
+// the bytes consumed, as read(2) would have left it.
+void input_close(input_t *in);
+const char *input_backend_name(input_backend_t backend);
+
+// Process-wide pool of INPUT_BUF_SIZE buffers, safe from any thread.
+unsigned char *input_buf_get(void);
+void input_buf_put(unsigned char *buf);
+
+#endif
@@ -0,0 +1,76 @@
+#define _GNU_SOURCE
+#include "replace.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static int sync_dir(const char *path) {
+    char *copy = strdup(path);
+    if (!copy) return -1;
+    int fd = open(dirname(copy), O_RDONLY | O_DIRECTORY);
+    free(copy);
+    if (fd < 0) return -1;
+    int rc = fsync(fd);
+    close(fd);
+    return rc;
+}
+
+int replace_mapped(const char *path, size_t size, replace_fill_fn fill, void *ctx, const char *who) {
+    size_t plen = strlen(path);
+    char *tmp = (char *)malloc(plen + 32);
+    if (!tmp) {
+        fprintf(stderr, "%s: %s\n", who, strerror(ENOMEM));
+        return -1;
+    }
+    // mkostemp creates a fresh name with O_EXCL and mode 0600: nothing
+    // planted next to path (a symlink in /tmp, say) is followed or
+    // truncated, and the names an ls index holds are not world-readable.
+    snprintf(tmp, plen + 32, "%s.XXXXXX", path);
+    int fd = mkostemp(tmp, O_CLOEXEC);
+    if (fd < 0) {
+        fprintf(stderr, "%s create: %s\n", who, strerror(errno));
+        free(tmp);
+        return -1;
+    }
+    void *map = MAP_FAILED;
+    if (ftruncate(fd, (off_t)size) != 0) {
+        fprintf(stderr, "%s ftruncate: %s\n", who, strerror(errno));
+        goto fail;
+    }
+    map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "%s mmap: %s\n", who, strerror(errno));
+        goto fail;
+    }
+    fill(map, ctx);
+    if (munmap(map, size) != 0 || fsync(fd) != 0) {
+        fprintf(stderr, "%s sync: %s\n", who, strerror(errno));
+        map = MAP_FAILED;
+        goto fail;
+    }
+    close(fd);
+    if (rename(tmp, path) != 0) {
+        fprintf(stderr, "%s rename: %s\n", who, strerror(errno));
+        unlink(tmp);
+        free(tmp);
+        return -1;
+    }
+    free(tmp);
+    // The rename is only durable once the directory holding it is synced.
+    if (sync_dir(path) != 0) {
+        fprintf(stderr, "%s sync directory: %s\n", who, strerror(errno));
+        return -1;
+    }
+    return 0;
+fail:
+    if (map != MAP_FAILED) munmap(map, size);
+    close(fd);
+    unlink(tmp);
+    free(tmp);
+    return -1;
+}
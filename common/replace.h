@@ -0,0 +1,14 @@
+#ifndef COMMON_REPLACE_H
+#define COMMON_REPLACE_H
+#include <stddef.h>
+
+typedef void (*replace_fill_fn)(void *map, void *ctx);
+
+// Writes a new path of size bytes through a temporary file next to it,
+// created exclusively with mode 0600: fill gets a writable mapping of the
+// zeroed file, which is then synced, renamed over path and made durable
+// with a sync of the directory. A crash leaves either the old file or the
+// new one. Failures are reported on stderr as "who: ..." and return -1.
+int replace_mapped(const char *path, size_t size, replace_fill_fn fill, void *ctx, const char *who);
+
+#endif
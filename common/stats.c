@@ -0,0 +1,259 @@
+#include "stats.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#define STATS_MAX_PHASES 16
+#define STATS_MAX_ENGINES 16
+#define STATS_MAX_CHUNKS 8
+
+int stats_enabled;
+uint64_t stats_counters[STATS_NCOUNTERS];
+
+static const char *const counter_names[STATS_NCOUNTERS] = {
+    "bytes_read", "bytes_written", "open", "read", "pread", "write", "mmap",
+    "sendfile", "fsync", "stat", "getdents"
+};
+
+typedef struct stats_phase_acc {
+    const char *name;
+    double wall;
+    double cpu;
+} stats_phase_acc_t;
+
+typedef struct stats_engine_acc {
+    const char *what;
+    const char *choice;
+    uint64_t count;
+} stats_engine_acc_t;
+
+typedef struct stats_chunk_acc {
+    const char *what;
+    uint64_t count;
+    uint64_t units;
+    double total, min, max;
+} stats_chunk_acc_t;
+
+static struct {
+    const char *tool;
+    int json;
+    double start;
+    stats_phase_acc_t phases[STATS_MAX_PHASES];
+    size_t nphases;
+    int current;            // index into phases, -1 when none runs
+    double phase_wall, phase_cpu;
+    stats_engine_acc_t engines[STATS_MAX_ENGINES];
+    size_t nengines;
+    stats_chunk_acc_t chunks[STATS_MAX_CHUNKS];
+    size_t nchunks;
+    pthread_mutex_t mu;     // engines and chunks
+    struct rusage ru0;      // at stats_init, so a daemon worker reports one request
+    int registered;
+} st = { .current = -1, .mu = PTHREAD_MUTEX_INITIALIZER };
+
+static double mono_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+double stats_now(void) {
+    return stats_enabled ? mono_now() : 0;
+}
+
+static double cpu_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static inline double tv_sec(const struct timeval *tv) {
+    return (double)tv->tv_sec + (double)tv->tv_usec / 1e6;
+}
+
+void stats_phase(const char *name) {
+    if (!stats_enabled) return;
+    double wall = mono_now(), cpu = cpu_now();
+    if (st.current >= 0) {
+        st.phases[st.current].wall += wall - st.phase_wall;
+        st.phases[st.current].cpu += cpu - st.phase_cpu;
+        st.current = -1;
+    }
+    if (!name) return;
+    size_t i = 0;
+    while (i < st.nphases && strcmp(st.phases[i].name, name) != 0) i++;
+    if (i == st.nphases) {
+        if (st.nphases == STATS_MAX_PHASES) return;
+        st.phases[st.nphases++].name = name;
+    }
+    st.current = (int)i;
+    st.phase_wall = wall;
+    st.phase_cpu = cpu;
+}
+
+void stats_engine(const char *what, const char *choice) {
+    if (!stats_enabled) return;
+    pthread_mutex_lock(&st.mu);
+    size_t i = 0;
+    while (i < st.nengines && (strcmp(st.engines[i].what, what) != 0 || strcmp(st.engines[i].choice, choice) != 0)) i++;
+    if (i < STATS_MAX_ENGINES) {
+        if (i == st.nengines) {
+            st.engines[i].what = what;
+            st.engines[i].choice = choice;
+            st.nengines++;
+        }
+        st.engines[i].count++;
+    }
+    pthread_mutex_unlock(&st.mu);
+}
+
+void stats_chunk(const char *what, double seconds, uint64_t units) {
+    if (!stats_enabled) return;
+    pthread_mutex_lock(&st.mu);
+    size_t i = 0;
+    while (i < st.nchunks && strcmp(st.chunks[i].what, what) != 0) i++;
+    if (i < STATS_MAX_CHUNKS) {
+        stats_chunk_acc_t *c = &st.chunks[i];
+        if (i == st.nchunks) {
+            memset(c, 0, sizeof(*c));
+            c->what = what;
+            c->min = seconds;
+            st.nchunks++;
+        }
+        c->count++;
+        c->units += units;
+        c->total += seconds;
+        if (seconds < c->min) c->min = seconds;
+        if (seconds > c->max) c->max = seconds;
+    }
+    pthread_mutex_unlock(&st.mu);
+}
+
+// Slowest chunk over the mean: 1.0 is perfectly even work.
+static double imbalance(const stats_chunk_acc_t *c) {
+    double mean = c->count ? c->total / (double)c->count : 0;
+    return mean > 0 ? c->max / mean : 1.0;
+}
+
+static void report_json(FILE *f, double wall, const struct rusage *ru) {
+    fprintf(f, "{\"tool\": \"%s\", \"wall_s\": %.6f, \"user_s\": %.6f, \"sys_s\": %.6f, "
+               "\"max_rss_kb\": %ld, \"minflt\": %ld, \"majflt\": %ld, \"nvcsw\": %ld, \"nivcsw\": %ld",
+            st.tool, wall, tv_sec(&ru->ru_utime), tv_sec(&ru->ru_stime), ru->ru_maxrss,
+            ru->ru_minflt, ru->ru_majflt, ru->ru_nvcsw, ru->ru_nivcsw);
+    fprintf(f, ", \"bytes_read\": %llu, \"bytes_written\": %llu, \"syscalls\": {",
+            (unsigned long long)stats_counters[STATS_BYTES_READ], (unsigned long long)stats_counters[STATS_BYTES_WRITTEN]);
+    for (int i = STATS_SYS_OPEN; i < STATS_NCOUNTERS; ++i) {
+        fprintf(f, "%s\"%s\": %llu", i == STATS_SYS_OPEN ? "" : ", ", counter_names[i], (unsigned long long)stats_counters[i]);
+    }
+    fprintf(f, "}, \"phases\": [");
+    for (size_t i = 0; i < st.nphases; ++i) {
+        fprintf(f, "%s{\"name\": \"%s\", \"wall_s\": %.6f, \"cpu_s\": %.6f}", i ? ", " : "",
+                st.phases[i].name, st.phases[i].wall, st.phases[i].cpu);
+    }
+    fprintf(f, "], \"engines\": {");
+    for (size_t i = 0; i < st.nengines; ++i) {
+        fprintf(f, "%s\"%s.%s\": %llu", i ? ", " : "", st.engines[i].what, st.engines[i].choice,
+                (unsigned long long)st.engines[i].count);
+    }
+    fprintf(f, "}, \"chunks\": {");
+    for (size_t i = 0; i < st.nchunks; ++i) {
+        const stats_chunk_acc_t *c = &st.chunks[i];
+        fprintf(f, "%s\"%s\": {\"count\": %llu, \"units\": %llu, \"total_s\": %.6f, \"min_s\": %.6f, "
+                   "\"max_s\": %.6f, \"imbalance\": %.3f}",
+                i ? ", " : "", c->what, (unsigned long long)c->count, (unsigned long long)c->units,
+                c->total, c->min, c->max, imbalance(c));
+    }
+    fprintf(f, "}}\n");
+}
+
+static void report_text(FILE *f, double wall, const struct rusage *ru) {
+    fprintf(f, "%s: stats: wall %.3fs user %.3fs sys %.3fs maxrss %ld KiB faults %ld/%ld\n", st.tool, wall,
+            tv_sec(&ru->ru_utime), tv_sec(&ru->ru_stime), ru->ru_maxrss, ru->ru_minflt, ru->ru_majflt);
+    fprintf(f, "%s: stats: read %llu bytes, wrote %llu bytes\n", st.tool,
+            (unsigned long long)stats_counters[STATS_BYTES_READ], (unsigned long long)stats_counters[STATS_BYTES_WRITTEN]);
+    fprintf(f, "%s: stats: syscalls", st.tool);
+    for (int i = STATS_SYS_OPEN; i < STATS_NCOUNTERS; ++i) {
+        if (stats_counters[i]) fprintf(f, " %s %llu", counter_names[i], (unsigned long long)stats_counters[i]);
+    }
+    fputc('\n', f);
+    for (size_t i = 0; i < st.nphases; ++i) {
+        fprintf(f, "%s: stats: phase %s wall %.3fs cpu %.3fs\n", st.tool, st.phases[i].name,
+                st.phases[i].wall, st.phases[i].cpu);
+    }
+    for (size_t i = 0; i < st.nengines; ++i) {
+        fprintf(f, "%s: stats: engine %s %s x%llu\n", st.tool, st.engines[i].what, st.engines[i].choice,
+                (unsigned long long)st.engines[i].count);
+    }
+    for (size_t i = 0; i < st.nchunks; ++i) {
+        const stats_chunk_acc_t *c = &st.chunks[i];
+        fprintf(f, "%s: stats: chunks %s x%llu min %.4fs max %.4fs imbalance %.2f\n", st.tool, c->what,
+                (unsigned long long)c->count, c->min, c->max, imbalance(c));
+    }
+}
+
+static void tv_sub(struct timeval *a, const struct timeval *b) {
+    a->tv_sec -= b->tv_sec;
+    a->tv_usec -= b->tv_usec;
+    if (a->tv_usec < 0) {
+        a->tv_sec--;
+        a->tv_usec += 1000000;
+    }
+}
+
+void stats_report(void) {
+    if (!stats_enabled) return;
+    stats_phase(NULL);
+    double wall = mono_now() - st.start;
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    tv_sub(&ru.ru_utime, &st.ru0.ru_utime);
+    tv_sub(&ru.ru_stime, &st.ru0.ru_stime);
+    ru.ru_minflt -= st.ru0.ru_minflt;
+    ru.ru_majflt -= st.ru0.ru_majflt;
+    ru.ru_nvcsw -= st.ru0.ru_nvcsw;
+    ru.ru_nivcsw -= st.ru0.ru_nivcsw;
+    pthread_mutex_lock(&st.mu);
+    if (st.json) report_json(stderr, wall, &ru);
+    else report_text(stderr, wall, &ru);
+    stats_enabled = 0;
+    memset(stats_counters, 0, sizeof(stats_counters));
+    st.nphases = st.nengines = st.nchunks = 0;
+    st.current = -1;
+    pthread_mutex_unlock(&st.mu);
+    fflush(stderr);
+}
+
+void stats_init(const char *tool, int *argc, char **argv) {
+    int enable = 0, json = 0;
+    const char *env = getenv("UNIXC_STATS");
+    if (env && *env && strcmp(env, "0") != 0) {
+        enable = 1;
+        json = strcmp(env, "json") == 0;
+    }
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        if (strcmp(argv[i], "--") == 0) {
+            while (i < *argc) argv[out++] = argv[i++];
+            break;
+        }
+        if (strcmp(argv[i], "--stats") == 0 || strcmp(argv[i], "--stats=json") == 0) {
+            enable = 1;
+            json = argv[i][7] == '=';
+            continue;
+        }
+        argv[out++] = argv[i];
+    }
+    *argc = out;
+    argv[out] = NULL;
+    if (!enable) return;
+    st.tool = tool;
+    st.json = json;
+    st.start = mono_now();
+    getrusage(RUSAGE_SELF, &st.ru0);
+    stats_enabled = 1;
+    if (!st.registered) atexit(stats_report);
+    st.registered = 1;
+}
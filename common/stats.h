@@ -0,0 +1,46 @@
+#ifndef COMMON_STATS_H
+#define COMMON_STATS_H
+#include <stdint.h>
+
+// Opt-in run statistics, reported on stderr at exit: --stats prints a
+// short summary, --stats=json or UNIXC_STATS=json one JSON object.
+// Counters cost a single predictable branch while disabled.
+typedef enum stats_counter {
+    STATS_BYTES_READ = 0,   // read, pread and mapped bytes
+    STATS_BYTES_WRITTEN,
+    STATS_SYS_OPEN,         // syscalls issued by the tools themselves
+    STATS_SYS_READ,
+    STATS_SYS_PREAD,
+    STATS_SYS_WRITE,
+    STATS_SYS_MMAP,
+    STATS_SYS_SENDFILE,
+    STATS_SYS_FSYNC,
+    STATS_SYS_STAT,
+    STATS_SYS_GETDENTS,
+    STATS_NCOUNTERS
+} stats_counter_t;
+
+extern int stats_enabled;
+extern uint64_t stats_counters[STATS_NCOUNTERS];
+
+static inline void stats_add(stats_counter_t c, uint64_t n) {
+    if (stats_enabled) __atomic_fetch_add(&stats_counters[c], n, __ATOMIC_RELAXED);
+}
+
+// Takes --stats[=json] out of argv before option parsing, checks
+// UNIXC_STATS and, when enabled, registers the report with atexit.
+void stats_init(const char *tool, int *argc, char **argv);
+// Ends the running phase and starts name (NULL only ends it). Phases of
+// the same name accumulate; call from the main thread only.
+void stats_phase(const char *name);
+// Counts one pass through a code path, e.g. stats_engine("input", "mmap").
+void stats_engine(const char *what, const char *choice);
+// One unit of work finished by a worker thread, for the balance figures.
+void stats_chunk(const char *what, double seconds, uint64_t units);
+// Monotonic seconds; 0 while disabled, so timing a chunk is free then.
+double stats_now(void);
+// Prints the report now and turns counting off until the next stats_init;
+// runs at exit otherwise. Times and faults count from stats_init.
+void stats_report(void);
+
+#endif
@@ -1,8 +1,10 @@
 #include "cp.h"
+#include "../common/stats.h"
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -14,21 +16,25 @@ static int copy_read_write(int src_fd, int dst_fd) {
     char buf[1 << 20]; 
     for (;;) {
         ssize_t n = read(src_fd, buf, sizeof(buf));
+        stats_add(STATS_SYS_READ, 1);
         if (n == 0) break; 
         if (n < 0) {
             if (errno == EINTR) continue;
             perror("cp: read");
             return -1;
         }
+        stats_add(STATS_BYTES_READ, (uint64_t)n);
         size_t off = 0;
         while (off < (size_t)n) {
             ssize_t w = write(dst_fd, buf + off, (size_t)n - off);
+            stats_add(STATS_SYS_WRITE, 1);
             if (w < 0) {
                 if (errno == EINTR) continue;
                 perror("cp: write");
                 return -1;
             }
             off += (size_t)w;
+            stats_add(STATS_BYTES_WRITTEN, (uint64_t)w);
         }
     }
     return 0;
@@ -51,6 +57,7 @@ static int copy_sendfile(int src_fd, int dst_fd) {
         size_t to_copy = (size_t)(st.st_size - offset);
         if (to_copy > (1U << 30)) to_copy = (1U << 30);
         ssize_t sent = sendfile(dst_fd, src_fd, &offset, to_copy);
+        stats_add(STATS_SYS_SENDFILE, 1);
         if (sent < 0) {
             if (errno == EINTR) continue;
             return -1;
@@ -58,6 +65,8 @@ static int copy_sendfile(int src_fd, int dst_fd) {
         if (sent == 0) {
             break;
         }
+        stats_add(STATS_BYTES_READ, (uint64_t)sent);
+        stats_add(STATS_BYTES_WRITTEN, (uint64_t)sent);
     }
     if (offset == st.st_size) return 0;
     return -1;
@@ -66,8 +75,12 @@ static int copy_sendfile(int src_fd, int dst_fd) {
 
 int do_cp(int src_fd, int dst_fd) {
 #if defined(__linux__)
+    stats_phase("copy");
     int ret = copy_sendfile(src_fd, dst_fd);
     if (ret == 0) {
+        stats_engine("cp", "sendfile");
+        stats_phase("fsync");
+        stats_add(STATS_SYS_FSYNC, 1);
         if (fsync(dst_fd) != 0) {
             perror("cp: fsync dst");
             return -1;
@@ -86,16 +99,23 @@ int do_cp(int src_fd, int dst_fd) {
         perror("cp: ftruncate dst");
         return -1;
     }
+    stats_engine("cp", "read_write");
     ret = copy_read_write(src_fd, dst_fd);
     if (ret != 0) return ret;
+    stats_phase("fsync");
+    stats_add(STATS_SYS_FSYNC, 1);
     if (fsync(dst_fd) != 0) {
         perror("cp: fsync dst");
         return -1;
     }
     return 0;
 #else
+    stats_phase("copy");
+    stats_engine("cp", "read_write");
     int ret = copy_read_write(src_fd, dst_fd);
     if (ret != 0) return ret;
+    stats_phase("fsync");
+    stats_add(STATS_SYS_FSYNC, 1);
     if (fsync(dst_fd) != 0) {
         perror("cp: fsync dst");
         return -1;
@@ -2,5 +2,7 @@
 #define CP_H
 
 int do_cp(int src_fd, int dst_fd);
+// Command-line entry point; main() calls it unless built with UNIXC_MULTICALL.
+int cp_main(int argc, char **argv);
 
 #endif
@@ -1,4 +1,5 @@
 #include "cp.h"
+#include "../common/stats.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -10,7 +11,8 @@ static void print_usage(const char *prog) {
     fprintf(stderr, "Usage: %s <src> <dst>\n", prog);
 }
 
-int main(int argc, char **argv) {
+int cp_main(int argc, char **argv) {
+    stats_init("cp", &argc, argv);
     if (argc != 3) {
         print_usage(argv[0]);
         return 1;
@@ -54,3 +56,9 @@ int main(int argc, char **argv) {
     close(dst_fd);
     return 0;
 }
+
+#ifndef UNIXC_MULTICALL
+int main(int argc, char **argv) {
+    return cp_main(argc, argv);
+}
+#endif
@@ -0,0 +1,131 @@
+#define _GNU_SOURCE // struct ucred
+#include "../daemon.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// Thin client for unixcd: run as a link named after a tool, or as
+// "unixc-client TOOL args...". It sends its stdin, stdout, stderr and
+// working directory along with argv and exits with the tool's status.
+static int write_full(int fd, const void *buf, size_t n) {
+    size_t off = 0;
+    while (off < n) {
+        ssize_t w = write(fd, (const char *)buf + off, n - off);
+        if (w < 0 && errno == EINTR) continue;
+        if (w < 0) return -1;
+        off += (size_t)w;
+    }
+    return 0;
+}
+
+static int connect_daemon(void) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (unixcd_socket_path(addr.sun_path, sizeof(addr.sun_path)) != 0) {
+        fprintf(stderr, "unixc: socket path too long\n");
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        fprintf(stderr, "unixc: %s: %s\n", addr.sun_path, strerror(errno));
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    // The daemon gets our descriptors, so it has to be our own user's.
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0 || cred.uid != getuid()) {
+        fprintf(stderr, "unixc: %s: daemon runs as another user\n", addr.sun_path);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char **argv) {
+    const char *base = strrchr(argv[0], '/');
+    base = base ? base + 1 : argv[0];
+    if (strncmp(base, "unixc", 5) == 0) {
+        if (argc < 2) {
+            fprintf(stderr, "Usage: %s TOOL [args ...], or run it through a link named TOOL\n", base);
+            return 1;
+        }
+        argc--;
+        argv++;
+    }
+
+    size_t len = 0;
+    for (int i = 0; i < argc; ++i) len += strlen(argv[i]) + 1;
+    if (len > UNIXCD_MAX_ARGS) {
+        fprintf(stderr, "unixc: argument list too long\n");
+        return 1;
+    }
+    char *args = (char *)malloc(len);
+    if (!args) {
+        perror("unixc: malloc");
+        return 1;
+    }
+    size_t off = 0;
+    for (int i = 0; i < argc; ++i) {
+        size_t n = strlen(argv[i]) + 1;
+        memcpy(args + off, argv[i], n);
+        off += n;
+    }
+
+    int fds[UNIXCD_NFDS];
+    for (int i = 0; i < 3; ++i) {
+        // a closed standard descriptor is passed as /dev/null
+        fds[i] = fcntl(i, F_GETFD) >= 0 ? i : open("/dev/null", O_RDWR | O_CLOEXEC);
+    }
+    fds[3] = open(".", O_PATH | O_DIRECTORY | O_CLOEXEC);
+    if (fds[3] < 0) {
+        perror("unixc: working directory");
+        return 1;
+    }
+    int conn = connect_daemon();
+    if (conn < 0) return 1;
+
+    unixcd_request_t req = { UNIXCD_MAGIC, (uint32_t)argc, (uint32_t)len };
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(sizeof(fds))];
+    } ctl;
+    memset(&ctl, 0, sizeof(ctl));
+    struct iovec iov = { &req, sizeof(req) };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = ctl.buf;
+    msg.msg_controllen = sizeof(ctl.buf);
+    struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+    c->cmsg_level = SOL_SOCKET;
+    c->cmsg_type = SCM_RIGHTS;
+    c->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(c), fds, sizeof(fds));
+    ssize_t n;
+    do {
+        n = sendmsg(conn, &msg, MSG_NOSIGNAL);
+    } while (n < 0 && errno == EINTR);
+    if (n != (ssize_t)sizeof(req) || write_full(conn, args, len) != 0) {
+        perror("unixc: send");
+        return 1;
+    }
+    free(args);
+
+    int32_t status;
+    size_t got = 0;
+    while (got < sizeof(status)) {
+        n = read(conn, (char *)&status + got, sizeof(status) - got);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            fprintf(stderr, "unixc: daemon closed the connection before %s finished\n", argv[0]);
+            return 1;
+        }
+        got += (size_t)n;
+    }
+    return status;
+}
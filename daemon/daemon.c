@@ -0,0 +1,305 @@
+#define _GNU_SOURCE
+#include "daemon.h"
+#include "../common/stats.h"
+#include "../multicall/tools.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio_ext.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#define UNIXCD_RECV_TIMEOUT 5   // seconds a client may take to send its request
+
+typedef struct request {
+    int fds[UNIXCD_NFDS];
+    int argc;
+    char **argv;
+    char *args;
+} request_t;
+
+static volatile sig_atomic_t stopping;
+static int devnull = -1;
+static int log_fd = 2;      // the daemon's own stderr; a worker's 0-2 belong to the client
+
+static void on_stop(int sig) {
+    (void)sig;
+    stopping = 1;
+}
+
+static int read_full(int fd, void *buf, size_t n) {
+    size_t off = 0;
+    while (off < n) {
+        ssize_t r = read(fd, (char *)buf + off, n - off);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return -1;
+        off += (size_t)r;
+    }
+    return 0;
+}
+
+static int write_full(int fd, const void *buf, size_t n) {
+    size_t off = 0;
+    while (off < n) {
+        ssize_t w = write(fd, (const char *)buf + off, n - off);
+        if (w < 0 && errno == EINTR) continue;
+        if (w < 0) return -1;
+        off += (size_t)w;
+    }
+    return 0;
+}
+
+// A socket file nobody answers on is left over from a daemon that died and
+// is replaced; a live one means another daemon already serves the path.
+static int listen_on(const char *path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "unixcd: %s: socket path too long\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("unixcd: socket");
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+        fprintf(stderr, "unixcd: already running on %s\n", path);
+        close(fd);
+        return -1;
+    }
+    close(fd);
+    struct stat st;
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode)) unlink(path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("unixcd: socket");
+        return -1;
+    }
+    mode_t old = umask(077);
+    int rc = bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+    umask(old);
+    if (rc != 0 || listen(fd, 128) != 0) {
+        fprintf(stderr, "unixcd: %s: %s\n", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void request_free(request_t *rq) {
+    for (int i = 0; i < UNIXCD_NFDS; ++i) {
+        if (rq->fds[i] >= 0) close(rq->fds[i]);
+    }
+    free(rq->argv);
+    free(rq->args);
+}
+
+// Reads the header with its descriptors, then the arguments. Anything
+// malformed drops the connection without an answer.
+static int recv_request(int conn, request_t *rq) {
+    memset(rq, 0, sizeof(*rq));
+    for (int i = 0; i < UNIXCD_NFDS; ++i) rq->fds[i] = -1;
+
+    unixcd_request_t req;
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(UNIXCD_NFDS * sizeof(int))];
+    } ctl;
+    struct iovec iov = { &req, sizeof(req) };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = ctl.buf;
+    msg.msg_controllen = sizeof(ctl.buf);
+    ssize_t n;
+    do {
+        n = recvmsg(conn, &msg, MSG_WAITALL | MSG_CMSG_CLOEXEC);
+    } while (n < 0 && errno == EINTR);
+    if (n < 0) return -1;
+
+    int nfds = 0;
+    for (struct cmsghdr *c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c)) {
+        if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS) continue;
+        size_t k = (c->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (size_t i = 0; i < k; ++i) {
+            int fd;
+            memcpy(&fd, CMSG_DATA(c) + i * sizeof(int), sizeof(int));
+            if (nfds < UNIXCD_NFDS) rq->fds[nfds++] = fd;
+            else close(fd);
+        }
+    }
+    if ((size_t)n != sizeof(req) || nfds != UNIXCD_NFDS || (msg.msg_flags & MSG_CTRUNC) ||
+        req.magic != UNIXCD_MAGIC || req.argc == 0 || req.len == 0 || req.len > UNIXCD_MAX_ARGS) {
+        return -1;
+    }
+
+    rq->args = (char *)malloc(req.len);
+    rq->argv = (char **)malloc(((size_t)req.argc + 1) * sizeof(char *));
+    if (!rq->args || !rq->argv || read_full(conn, rq->args, req.len) != 0) return -1;
+    if (rq->args[req.len - 1] != '\0') return -1;
+    size_t argc = 0;
+    for (size_t off = 0; off < req.len; off += strlen(rq->args + off) + 1) {
+        if (argc == req.argc) return -1;
+        rq->argv[argc++] = rq->args + off;
+    }
+    if (argc != req.argc) return -1;
+    rq->argv[argc] = NULL;
+    rq->argc = (int)argc;
+    return 0;
+}
+
+// Runs the tool on the client's descriptors and directory, then puts the
+// worker back on /dev/null and / so nothing of the client is held between
+// requests. stdio is flushed and purged, so no output or buffered input
+// carries over into the next request.
+static int32_t run_request(request_t *rq) {
+    const char *base = strrchr(rq->argv[0], '/');
+    base = base ? base + 1 : rq->argv[0];
+    const unixc_tool_t *t = unixc_tool_find(base);
+    if (!t) {
+        dprintf(rq->fds[2], "unixcd: %s: no such tool\n", base);
+        return 127;
+    }
+    int32_t status = 1;
+    int i = 0;
+    while (i < 3 && dup2(rq->fds[i], i) >= 0) i++;
+    if (i < 3) {
+        dprintf(rq->fds[2], "unixcd: dup2: %s\n", strerror(errno));
+    } else if (fchdir(rq->fds[3]) != 0) {
+        fprintf(stderr, "unixcd: working directory: %s\n", strerror(errno));
+    } else {
+        optind = 0;     // glibc: full rescan, including getopt_long state
+        opterr = 1;
+        status = t->main(rq->argc, rq->argv);
+        stats_report();
+    }
+    fflush(stdout);
+    fflush(stderr);
+    __fpurge(stdout);
+    __fpurge(stdin);
+    clearerr(stdout);
+    clearerr(stderr);
+    clearerr(stdin);
+    for (i = 0; i < 3; ++i) dup2(devnull, i);
+    if (chdir("/") != 0) dprintf(log_fd, "unixcd: chdir /: %s\n", strerror(errno));
+    return status;
+}
+
+static void serve_one(int conn) {
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    // Requests run with the daemon's privileges, so only its own user may send them.
+    if (getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0 || cred.uid != geteuid()) return;
+    struct timeval tv = { UNIXCD_RECV_TIMEOUT, 0 };
+    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    request_t rq;
+    if (recv_request(conn, &rq) == 0) {
+        int32_t status = run_request(&rq);
+        write_full(conn, &status, sizeof(status));
+    }
+    request_free(&rq);
+}
+
+static void worker(int lfd, unsigned max_requests) {
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+    // A client that went away turns into EPIPE for the tool, not a dead worker.
+    signal(SIGPIPE, SIG_IGN);
+    log_fd = dup(2);
+    for (int i = 0; i < 3; ++i) dup2(devnull, i);
+    if (chdir("/") != 0) dprintf(log_fd, "unixcd: chdir /: %s\n", strerror(errno));
+    for (unsigned served = 0; max_requests == 0 || served < max_requests;) {
+        int conn = accept4(lfd, NULL, NULL, SOCK_CLOEXEC);
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            dprintf(log_fd, "unixcd: accept: %s\n", strerror(errno));
+            _exit(1);
+        }
+        serve_one(conn);
+        close(conn);
+        served++;
+    }
+    _exit(0);
+}
+
+static pid_t spawn(int lfd, unsigned max_requests) {
+    pid_t pid = fork();
+    if (pid < 0) perror("unixcd: fork");
+    if (pid == 0) worker(lfd, max_requests);
+    return pid;
+}
+
+int unixcd_serve(const unixcd_options_t *opt) {
+    devnull = open("/dev/null", O_RDWR | O_CLOEXEC);
+    if (devnull < 0) {
+        perror("unixcd: /dev/null");
+        return -1;
+    }
+    int lfd = listen_on(opt->path);
+    if (lfd < 0) {
+        close(devnull);
+        return -1;
+    }
+    size_t n = opt->workers;
+    if (n == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        n = cpus < 1 ? 1 : (size_t)cpus;
+    }
+    pid_t *pids = (pid_t *)calloc(n, sizeof(pid_t));
+    if (!pids) {
+        perror("unixcd: malloc");
+        close(lfd);
+        unlink(opt->path);
+        return -1;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_stop;    // no SA_RESTART: waitpid returns to check stopping
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    for (size_t i = 0; i < n; ++i) {
+        while (!stopping && (pids[i] = spawn(lfd, opt->max_requests)) < 0) sleep(1);
+    }
+    while (!stopping) {
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) continue;
+            perror("unixcd: waitpid");
+            break;
+        }
+        size_t i = 0;
+        while (i < n && pids[i] != pid) i++;
+        if (i == n) continue;
+        if (WIFSIGNALED(status)) {
+            fprintf(stderr, "unixcd: worker %ld killed by signal %d\n", (long)pid, WTERMSIG(status));
+        } else if (WEXITSTATUS(status) != 0) {
+            sleep(1);   // the worker could not accept; do not spin on it
+        }
+        pids[i] = 0;
+        while (!stopping && (pids[i] = spawn(lfd, opt->max_requests)) < 0) sleep(1);
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (pids[i] > 0) kill(pids[i], SIGTERM);
+    }
+    while (waitpid(-1, NULL, 0) > 0 || errno == EINTR) {}
+    free(pids);
+    close(lfd);
+    close(devnull);
+    unlink(opt->path);
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef DAEMON_H
+#define DAEMON_H
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Wire format, client to daemon over a SOCK_STREAM Unix socket: one
+// unixcd_request_t carrying UNIXCD_NFDS descriptors (SCM_RIGHTS: stdin,
+// stdout, stderr and the working directory), then len bytes holding argc
+// NUL-terminated arguments. The daemon answers with one int32_t exit
+// status once the tool has returned and its output is flushed.
+#define UNIXCD_MAGIC 0x64637875u    // "uxcd"
+#define UNIXCD_NFDS 4
+#define UNIXCD_MAX_ARGS (4u << 20)  // bytes of arguments in one request
+
+typedef struct unixcd_request {
+    uint32_t magic;
+    uint32_t argc;
+    uint32_t len;
+} unixcd_request_t;
+
+// $UNIXCD_SOCKET, else unixcd.sock in $XDG_RUNTIME_DIR, else
+// /tmp/unixcd-UID.sock. Returns -1 if it does not fit in n.
+static inline int unixcd_socket_path(char *buf, size_t n) {
+    const char *env = getenv("UNIXCD_SOCKET");
+    const char *run = getenv("XDG_RUNTIME_DIR");
+    int len;
+    if (env && *env) len = snprintf(buf, n, "%s", env);
+    else if (run && *run) len = snprintf(buf, n, "%s/unixcd.sock", run);
+    else len = snprintf(buf, n, "/tmp/unixcd-%u.sock", (unsigned)getuid());
+    return len < 0 || (size_t)len >= n ? -1 : 0;
+}
+
+typedef struct unixcd_options {
+    const char *path;       // socket to listen on
+    size_t workers;         // worker processes, 0 = one per CPU
+    unsigned max_requests;  // a worker is replaced after this many, 0 = never
+} unixcd_options_t;
+
+// Listens on opt->path and serves requests on a pool of preforked workers
+// until SIGINT or SIGTERM. Returns 0 after a clean shutdown, -1 if the
+// socket could not be set up (reported on stderr).
+int unixcd_serve(const unixcd_options_t *opt);
+
+#endif
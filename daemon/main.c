@@ -0,0 +1,44 @@
+#include "daemon.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define UNIXCD_MAX_REQUESTS 1000    // default -m: bounds what a leak or stale cache can grow to
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [-s socket] [-w workers] [-m requests]\n", prog);
+    fprintf(stderr, "  -s  socket path (default $UNIXCD_SOCKET, $XDG_RUNTIME_DIR/unixcd.sock\n");
+    fprintf(stderr, "      or /tmp/unixcd-UID.sock)\n");
+    fprintf(stderr, "  -w  worker processes (default one per CPU)\n");
+    fprintf(stderr, "  -m  requests per worker before it is replaced, 0 = never (default %u)\n",
+            UNIXCD_MAX_REQUESTS);
+}
+
+int main(int argc, char **argv) {
+    unixcd_options_t opt = { .path = NULL, .workers = 0, .max_requests = UNIXCD_MAX_REQUESTS };
+    char path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+    int c;
+    while ((c = getopt(argc, argv, "s:w:m:")) != -1) {
+        switch (c) {
+            case 's': opt.path = optarg; break;
+            case 'w': opt.workers = (size_t)atoi(optarg); break;
+            case 'm': opt.max_requests = (unsigned)atoi(optarg); break;
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+    if (optind < argc) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (!opt.path) {
+        if (unixcd_socket_path(path, sizeof(path)) != 0) {
+            fprintf(stderr, "unixcd: socket path too long\n");
+            return 1;
+        }
+        opt.path = path;
+    }
+    return unixcd_serve(&opt) == 0 ? 0 : 1;
+}
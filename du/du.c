@@ -0,0 +1,161 @@
+#include "du.h"
+#include "../ls/ls.h"
+#include "../common/hash.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// (st_dev, st_ino) of multiply-linked files already counted.
+typedef struct inode_set {
+    uint64_t *keys;     // dev, ino pairs; a zero pair is an empty slot
+    size_t cap;         // pairs, power of two
+    size_t count;
+} inode_set_t;
+
+// One directory on the path from the root to the one being read. Its
+// total is final once the walk leaves its subtree.
+typedef struct du_frame {
+    char *path;
+    size_t len;
+    uint64_t bytes;
+} du_frame_t;
+
+typedef struct du_state {
+    const du_options_t *opt;
+    du_emit_fn fn;
+    void *ctx;
+    du_frame_t *stack;
+    size_t depth, cap;
+    inode_set_t seen;
+    int errors;
+} du_state_t;
+
+static int set_grow(inode_set_t *s) {
+    size_t cap = s->cap ? s->cap * 2 : 1024;
+    uint64_t *keys = (uint64_t *)calloc(cap * 2, sizeof(uint64_t));
+    if (!keys) return -1;
+    for (size_t i = 0; i < s->cap; ++i) {
+        uint64_t dev = s->keys[2 * i], ino = s->keys[2 * i + 1];
+        if (!dev && !ino) continue;
+        size_t j = hash_inode(dev, ino) & (cap - 1);
+        while (keys[2 * j] || keys[2 * j + 1]) j = (j + 1) & (cap - 1);
+        keys[2 * j] = dev;
+        keys[2 * j + 1] = ino;
+    }
+    free(s->keys);
+    s->keys = keys;
+    s->cap = cap;
+    return 0;
+}
+
+// Returns 1 if the inode was new, 0 if it had been counted already.
+static int set_insert(inode_set_t *s, uint64_t dev, uint64_t ino) {
+    if (!dev && !ino) ino = 1; // keep the empty-slot marker free
+    if ((s->count + 1) * 2 > s->cap && set_grow(s) != 0) return 1;
+    size_t mask = s->cap - 1;
+    for (size_t i = hash_inode(dev, ino) & mask;; i = (i + 1) & mask) {
+        if (!s->keys[2 * i] && !s->keys[2 * i + 1]) {
+            s->keys[2 * i] = dev;
+            s->keys[2 * i + 1] = ino;
+            s->count++;
+            return 1;
+        }
+        if (s->keys[2 * i] == dev && s->keys[2 * i + 1] == ino) return 0;
+    }
+}
+
+static uint64_t entry_bytes(du_state_t *s, const struct stat *st) {
+    if (!S_ISDIR(st->st_mode) && st->st_nlink > 1 &&
+        !set_insert(&s->seen, (uint64_t)st->st_dev, (uint64_t)st->st_ino)) {
+        return 0;
+    }
+    if (s->opt->apparent) return st->st_size > 0 ? (uint64_t)st->st_size : 0;
+    return (uint64_t)st->st_blocks * 512;
+}
+
+static void pop_frame(du_state_t *s) {
+    du_frame_t *f = &s->stack[--s->depth];
+    int depth = (int)s->depth;
+    if (s->opt->max_depth < 0 || depth <= s->opt->max_depth) s->fn(f->path, f->bytes, depth, s->ctx);
+    if (s->depth > 0) s->stack[s->depth - 1].bytes += f->bytes;
+    free(f->path);
+}
+
+static int is_parent(const du_frame_t *f, const char *path) {
+    if (strncmp(path, f->path, f->len) != 0) return 0;
+    return path[f->len] == '/' || (f->len > 0 && f->path[f->len - 1] == '/');
+}
+
+// ls_walk hands directories over in pre-order, so every frame that is not
+// an ancestor of the next directory is complete and can be folded upward.
+static void on_dir(const char *dir_path, const ls_entry_list_t *entries, int error, void *ctx) {
+    du_state_t *s = (du_state_t *)ctx;
+    while (s->depth > 0 && !is_parent(&s->stack[s->depth - 1], dir_path)) pop_frame(s);
+    if (s->depth == s->cap) {
+        size_t cap = s->cap ? s->cap * 2 : 32;
+        du_frame_t *stack = (du_frame_t *)realloc(s->stack, cap * sizeof(du_frame_t));
+        if (!stack) {
+            s->errors = 1;
+            return;
+        }
+        s->stack = stack;
+        s->cap = cap;
+    }
+    du_frame_t *f = &s->stack[s->depth];
+    f->path = strdup(dir_path);
+    if (!f->path) {
+        s->errors = 1;
+        return;
+    }
+    f->len = strlen(dir_path);
+    f->bytes = 0;
+    s->depth++;
+    if (!entries) {
+        fprintf(stderr, "du: cannot read directory '%s': %s\n", dir_path, strerror(error));
+        s->errors = 1;
+        return;
+    }
+    // "." stands for the directory itself; subdirectories count themselves
+    // through their own "." once they are read.
+    for (size_t i = 0; i < entries->last_entry_idx; ++i) {
+        const ls_entry_t *e = &entries->entries[i];
+        const char *name = ls_entry_name(entries, e);
+        if (S_ISDIR(e->st.st_mode) && strcmp(name, ".") != 0) continue;
+        f->bytes += entry_bytes(s, &e->st);
+    }
+}
+
+int du_walk(const char *path, const du_options_t *opt, du_emit_fn fn, void *ctx) {
+    struct stat st;
+    if (lstat(path, &st) != 0) return -1;
+    du_state_t s;
+    memset(&s, 0, sizeof(s));
+    s.opt = opt;
+    s.fn = fn;
+    s.ctx = ctx;
+    if (!S_ISDIR(st.st_mode)) {
+        fn(path, entry_bytes(&s, &st), 0, ctx);
+        free(s.seen.keys);
+        return 0;
+    }
+
+    ls_options_t lopt;
+    memset(&lopt, 0, sizeof(lopt));
+    lopt.show_all_files = 1;
+    lopt.recursive_listing = 1;
+    lopt.unsorted = 1;
+    lopt.want_blocks = 1;
+    lopt.jobs = opt->jobs;
+    int rc = ls_walk(path, &lopt, on_dir, &s);
+    int saved = errno;
+    while (s.depth > 0) pop_frame(&s);
+    free(s.stack);
+    free(s.seen.keys);
+    if (rc != 0) {
+        errno = saved;
+        return -1;
+    }
+    return s.errors ? 1 : 0;
+}
@@ -0,0 +1,22 @@
+#ifndef DU_H
+#define DU_H
+#include <stdint.h>
+
+typedef struct du_options {
+    int apparent;   // -b: sum st_size instead of allocated blocks
+    int max_depth;  // -d, -s: deepest directory reported, -1 = all
+    int jobs;       // -j, directories read in parallel, 0 = one per CPU
+} du_options_t;
+
+// Called in post-order for every directory up to max_depth (the root is
+// depth 0) with the bytes used by its whole subtree.
+typedef void (*du_emit_fn)(const char *path, uint64_t bytes, int depth, void *ctx);
+
+// Disk usage of path, built on the ls walker. Hard links are counted once
+// per (st_dev, st_ino). Returns 0, 1 if some directories could not be read
+// (reported on stderr), or -1 if path itself is inaccessible.
+int du_walk(const char *path, const du_options_t *opt, du_emit_fn fn, void *ctx);
+// Command-line entry point; main() calls it unless built with UNIXC_MULTICALL.
+int du_main(int argc, char **argv);
+
+#endif
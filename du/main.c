@@ -0,0 +1,140 @@
+#include "du.h"
+#include "../common/stats.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef struct du_record {
+    char *path;
+    uint64_t bytes;
+} du_record_t;
+
+typedef struct du_report {
+    int human;          // -h
+    int bytes;          // -b
+    int sorted;         // -S: largest first, printed after the walk
+    du_record_t *recs;
+    size_t n, cap;
+    uint64_t total;     // -c
+} du_report_t;
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [-bchsS] [-d depth] [-j jobs] [path ...]\n", prog);
+}
+
+// du -h style: one decimal below 10, always rounded up.
+static void human_size(uint64_t v, char *buf, size_t n) {
+    static const char units[] = "KMGTPE";
+    if (v < 1024) {
+        snprintf(buf, n, "%llu", (unsigned long long)v);
+        return;
+    }
+    int idx = 0;
+    uint64_t scale = 1024;
+    while (idx < 5 && v / scale >= 1024) {
+        scale *= 1024;
+        idx++;
+    }
+    uint64_t whole = v / scale, rem = v % scale;
+    if (whole < 10) {
+        uint64_t tenths = whole * 10 + (rem * 10 + scale - 1) / scale;
+        if (tenths < 100) {
+            snprintf(buf, n, "%llu.%llu%c", (unsigned long long)(tenths / 10), (unsigned long long)(tenths % 10), units[idx]);
+            return;
+        }
+    }
+    snprintf(buf, n, "%llu%c", (unsigned long long)(whole + (rem != 0)), units[idx]);
+}
+
+static void print_size(const du_report_t *r, uint64_t v, const char *path) {
+    char buf[32];
+    if (r->human) human_size(v, buf, sizeof(buf));
+    else if (r->bytes) snprintf(buf, sizeof(buf), "%llu", (unsigned long long)v);
+    else snprintf(buf, sizeof(buf), "%llu", (unsigned long long)((v + 1023) / 1024));
+    printf("%s\t%s\n", buf, path);
+}
+
+static void on_total(const char *path, uint64_t bytes, int depth, void *ctx) {
+    du_report_t *r = (du_report_t *)ctx;
+    if (depth == 0) r->total += bytes;
+    if (!r->sorted) {
+        print_size(r, bytes, path);
+        return;
+    }
+    if (r->n == r->cap) {
+        size_t cap = r->cap ? r->cap * 2 : 256;
+        du_record_t *recs = (du_record_t *)realloc(r->recs, cap * sizeof(du_record_t));
+        if (!recs) {
+            perror("du: realloc");
+            return;
+        }
+        r->recs = recs;
+        r->cap = cap;
+    }
+    r->recs[r->n].path = strdup(path);
+    if (!r->recs[r->n].path) return;
+    r->recs[r->n++].bytes = bytes;
+}
+
+static int cmp_record(const void *a, const void *b) {
+    const du_record_t *ra = (const du_record_t *)a;
+    const du_record_t *rb = (const du_record_t *)b;
+    if (ra->bytes != rb->bytes) return ra->bytes < rb->bytes ? 1 : -1;
+    return strcmp(ra->path, rb->path);
+}
+
+int du_main(int argc, char **argv) {
+    du_options_t opt = {0, -1, 0};
+    du_report_t report;
+    memset(&report, 0, sizeof(report));
+    int show_total = 0;
+    stats_init("du", &argc, argv);
+    int c;
+    while ((c = getopt(argc, argv, "bchsSd:j:")) != -1) {
+        switch (c) {
+            case 'b': opt.apparent = 1; report.bytes = 1; break;
+            case 'c': show_total = 1; break;
+            case 'h': report.human = 1; break;
+            case 's': opt.max_depth = 0; break;
+            case 'S': report.sorted = 1; break;
+            case 'd': opt.max_depth = atoi(optarg); break;
+            case 'j': opt.jobs = atoi(optarg); break;
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    stats_phase("walk");
+    int exit_code = 0;
+    const char *dot = ".";
+    char **paths = optind < argc ? argv + optind : (char **)&dot;
+    int npaths = optind < argc ? argc - optind : 1;
+    for (int i = 0; i < npaths; ++i) {
+        int rc = du_walk(paths[i], &opt, on_total, &report);
+        if (rc < 0) {
+            fprintf(stderr, "du: cannot access '%s': %s\n", paths[i], strerror(errno));
+            exit_code = 1;
+        } else if (rc > 0) {
+            exit_code = 1;
+        }
+    }
+    if (report.sorted) {
+        qsort(report.recs, report.n, sizeof(du_record_t), cmp_record);
+        for (size_t i = 0; i < report.n; ++i) {
+            print_size(&report, report.recs[i].bytes, report.recs[i].path);
+            free(report.recs[i].path);
+        }
+        free(report.recs);
+    }
+    if (show_total) print_size(&report, report.total, "total");
+    return exit_code;
+}
+
+#ifndef UNIXC_MULTICALL
+int main(int argc, char **argv) {
+    return du_main(argc, argv);
+}
+#endif
@@ -0,0 +1,469 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // FNM_CASEFOLD
+#endif
+#include "filter.h"
+#include <ctype.h>
+#include <fnmatch.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+typedef enum {
+    OP_TRUE,
+    OP_FALSE,
+    OP_NAME,
+    OP_INAME,
+    OP_TYPE,
+    OP_SIZE,
+    OP_MTIME,
+    OP_PRUNE,
+    OP_NOT,
+    OP_AND,
+    OP_OR
+} op_t;
+
+// -name patterns are classified at compile time so the common shapes
+// never reach fnmatch.
+typedef enum {
+    GLOB_ANY,       // *
+    GLOB_LITERAL,   // abc
+    GLOB_SUFFIX,    // *abc
+    GLOB_PREFIX,    // abc*
+    GLOB_FNMATCH
+} glob_kind_t;
+
+typedef struct fnode {
+    op_t op;
+    int a, b;               // operands of NOT/AND/OR
+    int cmp;                // -1: less than n, 0: exactly n, 1: more than n
+    long long n;
+    long long unit;         // bytes per -size unit, seconds per -mtime/-mmin unit
+    mode_t type;
+    glob_kind_t glob;
+    char *pat;              // whole pattern, for fnmatch
+    const char *lit;        // the literal part of a classified pattern
+    size_t lit_len;
+} fnode_t;
+
+struct ls_filter {
+    fnode_t *nodes;
+    size_t n, cap;
+    int root;
+    int maxdepth;
+    int prunes;             // the expression contains -prune
+    unsigned need;
+    time_t now;
+};
+
+typedef struct parser {
+    char **tok;
+    size_t ntok, pos;
+    ls_filter_t *f;
+} parser_t;
+
+static int new_node(ls_filter_t *f, op_t op) {
+    if (f->n == f->cap) {
+        size_t cap = f->cap ? f->cap * 2 : 16;
+        fnode_t *nodes = (fnode_t *)realloc(f->nodes, cap * sizeof(fnode_t));
+        if (!nodes) return -1;
+        f->nodes = nodes;
+        f->cap = cap;
+    }
+    memset(&f->nodes[f->n], 0, sizeof(fnode_t));
+    f->nodes[f->n].op = op;
+    f->nodes[f->n].a = f->nodes[f->n].b = -1;
+    return (int)f->n++;
+}
+
+// Splits on blanks; '...' and "..." group, backslash escapes outside '...'.
+static char **tokenize(const char *s, size_t *ntok) {
+    size_t cap = 8, n = 0;
+    char **tok = (char **)malloc(cap * sizeof(char *));
+    char *buf = (char *)malloc(strlen(s) + 1);
+    if (!tok || !buf) goto fail;
+    while (*s) {
+        while (isspace((unsigned char)*s)) s++;
+        if (!*s) break;
+        size_t len = 0;
+        char quote = 0;
+        for (; *s && (quote || !isspace((unsigned char)*s)); s++) {
+            if (quote) {
+                if (*s == quote) quote = 0;
+                else if (*s == '\\' && quote == '"' && s[1]) buf[len++] = *++s;
+                else buf[len++] = *s;
+            } else if (*s == '\'' || *s == '"') {
+                quote = *s;
+            } else if (*s == '\\' && s[1]) {
+                buf[len++] = *++s;
+            } else {
+                buf[len++] = *s;
+            }
+        }
+        if (quote) {
+            fprintf(stderr, "ls: filter: unterminated quote\n");
+            goto fail;
+        }
+        if (n + 1 >= cap) {
+            cap *= 2;
+            char **nt = (char **)realloc(tok, cap * sizeof(char *));
+            if (!nt) goto fail;
+            tok = nt;
+        }
+        tok[n] = (char *)malloc(len + 1);
+        if (!tok[n]) goto fail;
+        memcpy(tok[n], buf, len);
+        tok[n++][len] = '\0';
+    }
+    free(buf);
+    *ntok = n;
+    return tok;
+fail:
+    for (size_t i = 0; tok && i < n; ++i) free(tok[i]);
+    free(tok);
+    free(buf);
+    return NULL;
+}
+
+static const char *next_arg(parser_t *p, const char *pred) {
+    if (p->pos >= p->ntok) {
+        fprintf(stderr, "ls: filter: missing argument to '%s'\n", pred);
+        return NULL;
+    }
+    return p->tok[p->pos++];
+}
+
+// [+-]N followed by an optional unit letter from units/scales.
+static int parse_num(const char *s, const char *pred, int *cmp, long long *n, char *unit) {
+    *cmp = 0;
+    if (*s == '+') { *cmp = 1; s++; }
+    else if (*s == '-') { *cmp = -1; s++; }
+    char *end;
+    if (!isdigit((unsigned char)*s)) goto bad;
+    *n = strtoll(s, &end, 10);
+    *unit = *end;
+    if (*end && end[1]) goto bad;
+    return 0;
+bad:
+    fprintf(stderr, "ls: filter: invalid argument to '%s'\n", pred);
+    return -1;
+}
+
+static void classify_glob(fnode_t *nd) {
+    const char *p = nd->pat;
+    size_t len = strlen(p);
+    size_t specials = strcspn(p, "*?[\\");
+    nd->glob = GLOB_FNMATCH;
+    if (specials == len) {
+        nd->glob = GLOB_LITERAL;
+        nd->lit = p;
+        nd->lit_len = len;
+    } else if (len == 1 && p[0] == '*') {
+        nd->glob = GLOB_ANY;
+    } else if (p[0] == '*' && strcspn(p + 1, "*?[\\") == len - 1) {
+        nd->glob = GLOB_SUFFIX;
+        nd->lit = p + 1;
+        nd->lit_len = len - 1;
+    } else if (specials == len - 1 && p[len - 1] == '*') {
+        nd->glob = GLOB_PREFIX;
+        nd->lit = p;
+        nd->lit_len = len - 1;
+    }
+}
+
+static int parse_or(parser_t *p);
+
+static int parse_primary(parser_t *p) {
+    ls_filter_t *f = p->f;
+    if (p->pos >= p->ntok) {
+        fprintf(stderr, "ls: filter: expected an expression\n");
+        return -1;
+    }
+    const char *t = p->tok[p->pos++];
+    if (strcmp(t, "(") == 0) {
+        int i = parse_or(p);
+        if (i < 0) return -1;
+        if (p->pos >= p->ntok || strcmp(p->tok[p->pos], ")") != 0) {
+            fprintf(stderr, "ls: filter: missing ')'\n");
+            return -1;
+        }
+        p->pos++;
+        return i;
+    }
+    if (strcmp(t, "!") == 0 || strcmp(t, "-not") == 0) {
+        int a = parse_primary(p);
+        if (a < 0) return -1;
+        int i = new_node(f, OP_NOT);
+        if (i >= 0) f->nodes[i].a = a;
+        return i;
+    }
+    if (strcmp(t, "-true") == 0) return new_node(f, OP_TRUE);
+    if (strcmp(t, "-false") == 0) return new_node(f, OP_FALSE);
+    if (strcmp(t, "-prune") == 0) {
+        f->prunes = 1;
+        return new_node(f, OP_PRUNE);
+    }
+    if (strcmp(t, "-name") == 0 || strcmp(t, "-iname") == 0) {
+        const char *arg = next_arg(p, t);
+        if (!arg) return -1;
+        int i = new_node(f, t[1] == 'i' ? OP_INAME : OP_NAME);
+        if (i < 0) return -1;
+        fnode_t *nd = &f->nodes[i];
+        nd->pat = strdup(arg);
+        if (!nd->pat) return -1;
+        if (nd->op == OP_NAME) classify_glob(nd);
+        return i;
+    }
+    if (strcmp(t, "-type") == 0) {
+        const char *arg = next_arg(p, t);
+        if (!arg) return -1;
+        static const char letters[] = "fdlpscb";
+        static const mode_t types[] = {S_IFREG, S_IFDIR, S_IFLNK, S_IFIFO, S_IFSOCK, S_IFCHR, S_IFBLK};
+        const char *c = arg[0] && !arg[1] ? strchr(letters, arg[0]) : NULL;
+        if (!c) {
+            fprintf(stderr, "ls: filter: unknown type '%s'\n", arg);
+            return -1;
+        }
+        int i = new_node(f, OP_TYPE);
+        if (i >= 0) f->nodes[i].type = types[c - letters];
+        f->need |= LS_FILTER_NEED_TYPE;
+        return i;
+    }
+    if (strcmp(t, "-size") == 0) {
+        const char *arg = next_arg(p, t);
+        int cmp;
+        long long n;
+        char unit;
+        if (!arg || parse_num(arg, t, &cmp, &n, &unit) != 0) return -1;
+        long long bytes;
+        switch (unit) {
+            case '\0': case 'b': bytes = 512; break;
+            case 'c': bytes = 1; break;
+            case 'w': bytes = 2; break;
+            case 'k': bytes = 1024; break;
+            case 'M': bytes = 1024LL * 1024; break;
+            case 'G': bytes = 1024LL * 1024 * 1024; break;
+            default:
+                fprintf(stderr, "ls: filter: invalid unit in '%s'\n", arg);
+                return -1;
+        }
+        int i = new_node(f, OP_SIZE);
+        if (i < 0) return -1;
+        f->nodes[i].cmp = cmp;
+        f->nodes[i].n = n;
+        f->nodes[i].unit = bytes;
+        f->need |= LS_FILTER_NEED_SIZE;
+        return i;
+    }
+    if (strcmp(t, "-mtime") == 0 || strcmp(t, "-mmin") == 0) {
+        const char *arg = next_arg(p, t);
+        int cmp;
+        long long n;
+        char unit;
+        if (!arg || parse_num(arg, t, &cmp, &n, &unit) != 0) return -1;
+        if (unit) {
+            fprintf(stderr, "ls: filter: invalid argument to '%s'\n", t);
+            return -1;
+        }
+        int i = new_node(f, OP_MTIME);
+        if (i < 0) return -1;
+        f->nodes[i].cmp = cmp;
+        f->nodes[i].n = n;
+        f->nodes[i].unit = t[2] == 't' ? 86400 : 60;
+        f->need |= LS_FILTER_NEED_MTIME;
+        return i;
+    }
+    if (strcmp(t, "-maxdepth") == 0) {
+        const char *arg = next_arg(p, t);
+        if (!arg) return -1;
+        char *end;
+        long d = strtol(arg, &end, 10);
+        if (*end || d < 0 || end == arg) {
+            fprintf(stderr, "ls: filter: invalid argument to '%s'\n", t);
+            return -1;
+        }
+        f->maxdepth = (int)d;
+        return new_node(f, OP_TRUE); // an option, true wherever it appears
+    }
+    fprintf(stderr, "ls: filter: unknown predicate '%s'\n", t);
+    return -1;
+}
+
+static int parse_and(parser_t *p) {
+    int left = parse_primary(p);
+    while (left >= 0 && p->pos < p->ntok) {
+        const char *t = p->tok[p->pos];
+        if (strcmp(t, "-o") == 0 || strcmp(t, "-or") == 0 || strcmp(t, ")") == 0) break;
+        if (strcmp(t, "-a") == 0 || strcmp(t, "-and") == 0) p->pos++;
+        int right = parse_primary(p);
+        if (right < 0) return -1;
+        int i = new_node(p->f, OP_AND);
+        if (i < 0) return -1;
+        p->f->nodes[i].a = left;
+        p->f->nodes[i].b = right;
+        left = i;
+    }
+    return left;
+}
+
+static int parse_or(parser_t *p) {
+    int left = parse_and(p);
+    while (left >= 0 && p->pos < p->ntok &&
+           (strcmp(p->tok[p->pos], "-o") == 0 || strcmp(p->tok[p->pos], "-or") == 0)) {
+        p->pos++;
+        int right = parse_and(p);
+        if (right < 0) return -1;
+        int i = new_node(p->f, OP_OR);
+        if (i < 0) return -1;
+        p->f->nodes[i].a = left;
+        p->f->nodes[i].b = right;
+        left = i;
+    }
+    return left;
+}
+
+ls_filter_t *ls_filter_compile(const char *expr) {
+    ls_filter_t *f = (ls_filter_t *)calloc(1, sizeof(ls_filter_t));
+    if (!f) return NULL;
+    f->maxdepth = -1;
+    f->now = time(NULL);
+    size_t ntok = 0;
+    char **tok = tokenize(expr, &ntok);
+    if (!tok) {
+        free(f);
+        return NULL;
+    }
+    parser_t p = {tok, ntok, 0, f};
+    f->root = ntok == 0 ? new_node(f, OP_TRUE) : parse_or(&p);
+    if (f->root >= 0 && p.pos < ntok) {
+        fprintf(stderr, "ls: filter: unexpected '%s'\n", tok[p.pos]);
+        f->root = -1;
+    }
+    for (size_t i = 0; i < ntok; ++i) free(tok[i]);
+    free(tok);
+    if (f->root < 0) {
+        ls_filter_free(f);
+        return NULL;
+    }
+    return f;
+}
+
+void ls_filter_free(ls_filter_t *f) {
+    if (!f) return;
+    for (size_t i = 0; i < f->n; ++i) free(f->nodes[i].pat);
+    free(f->nodes);
+    free(f);
+}
+
+unsigned ls_filter_need(const ls_filter_t *f) {
+    return f->need;
+}
+
+int ls_filter_maxdepth(const ls_filter_t *f) {
+    return f->maxdepth;
+}
+
+int ls_filter_prunes(const ls_filter_t *f) {
+    return f->prunes;
+}
+
+static int match_name(const fnode_t *nd, const char *name) {
+    size_t len;
+    switch (nd->glob) {
+        case GLOB_ANY:
+            return 1;
+        case GLOB_LITERAL:
+            return strcmp(name, nd->lit) == 0;
+        case GLOB_SUFFIX:
+            len = strlen(name);
+            return len >= nd->lit_len && memcmp(name + len - nd->lit_len, nd->lit, nd->lit_len) == 0;
+        case GLOB_PREFIX:
+            return strncmp(name, nd->lit, nd->lit_len) == 0;
+        default:
+            return fnmatch(nd->pat, name, 0) == 0;
+    }
+}
+
+static int match_iname(const fnode_t *nd, const char *name) {
+#ifdef FNM_CASEFOLD
+    return fnmatch(nd->pat, name, FNM_CASEFOLD) == 0;
+#else
+    size_t len = strlen(name);
+    char *lower = (char *)malloc(len + 1);
+    char *pat = strdup(nd->pat);
+    int ok = 0;
+    if (lower && pat) {
+        for (size_t i = 0; i <= len; ++i) lower[i] = (char)tolower((unsigned char)name[i]);
+        for (char *c = pat; *c; ++c) *c = (char)tolower((unsigned char)*c);
+        ok = fnmatch(pat, lower, 0) == 0;
+    }
+    free(lower);
+    free(pat);
+    return ok;
+#endif
+}
+
+static int compare(const fnode_t *nd, long long v) {
+    if (nd->cmp > 0) return v > nd->n;
+    if (nd->cmp < 0) return v < nd->n;
+    return v == nd->n;
+}
+
+// Three-valued: st == NULL is the pre-stat pass, where only the name and,
+// if known, the type are available.
+static int eval(const ls_filter_t *f, int i, const char *name, const struct stat *st, mode_t type, int *prune) {
+    const fnode_t *nd = &f->nodes[i];
+    int a, b;
+    switch (nd->op) {
+        case OP_TRUE:
+            return LS_FILTER_TRUE;
+        case OP_FALSE:
+            return LS_FILTER_FALSE;
+        case OP_NAME:
+            return match_name(nd, name);
+        case OP_INAME:
+            return match_iname(nd, name);
+        case OP_TYPE:
+            if (st) type = st->st_mode & S_IFMT;
+            if (!type) return LS_FILTER_UNKNOWN;
+            return type == nd->type;
+        case OP_SIZE:
+            if (!st) return LS_FILTER_UNKNOWN;
+            return compare(nd, st->st_size <= 0 ? 0 : (st->st_size + nd->unit - 1) / nd->unit);
+        case OP_MTIME: {
+            if (!st) return LS_FILTER_UNKNOWN;
+            long long age = (long long)f->now - (long long)st->st_mtime;
+            long long units = age >= 0 ? age / nd->unit : -((-age + nd->unit - 1) / nd->unit);
+            return compare(nd, units);
+        }
+        case OP_PRUNE:
+            if (prune) *prune = 1;
+            return LS_FILTER_TRUE;
+        case OP_NOT:
+            a = eval(f, nd->a, name, st, type, prune);
+            return a == LS_FILTER_UNKNOWN ? a : !a;
+        case OP_AND:
+            a = eval(f, nd->a, name, st, type, prune);
+            if (a == LS_FILTER_FALSE) return a;
+            b = eval(f, nd->b, name, st, type, prune);
+            if (b == LS_FILTER_FALSE) return b;
+            return a == LS_FILTER_TRUE && b == LS_FILTER_TRUE ? LS_FILTER_TRUE : LS_FILTER_UNKNOWN;
+        case OP_OR:
+            a = eval(f, nd->a, name, st, type, prune);
+            if (a == LS_FILTER_TRUE) return a;
+            b = eval(f, nd->b, name, st, type, prune);
+            if (b == LS_FILTER_TRUE) return b;
+            return a == LS_FILTER_FALSE && b == LS_FILTER_FALSE ? LS_FILTER_FALSE : LS_FILTER_UNKNOWN;
+    }
+    return LS_FILTER_UNKNOWN;
+}
+
+int ls_filter_pre(const ls_filter_t *f, const char *name, mode_t type) {
+    return eval(f, f->root, name, NULL, type & S_IFMT, NULL);
+}
+
+int ls_filter_eval(const ls_filter_t *f, const char *name, const struct stat *st, int *prune) {
+    *prune = 0;
+    return eval(f, f->root, name, st, 0, prune);
+}
@@ -0,0 +1,39 @@
+#ifndef LS_FILTER_H
+#define LS_FILTER_H
+#include <sys/stat.h>
+
+// find-style filter expressions (ls -e), compiled once into a node program:
+//   -name GLOB  -iname GLOB  -type [fdlpscb]  -size [+-]N[bckMG]
+//   -mtime [+-]DAYS  -mmin [+-]MINUTES  -maxdepth N  -prune  -true  -false
+//   ! EXPR   EXPR [-a] EXPR   EXPR -o EXPR   ( EXPR )
+typedef struct ls_filter ls_filter_t;
+
+enum {
+    LS_FILTER_FALSE = 0,
+    LS_FILTER_TRUE = 1,
+    LS_FILTER_UNKNOWN = 2   // depends on stat fields not supplied yet
+};
+
+// Stat fields an expression reads.
+enum {
+    LS_FILTER_NEED_TYPE = 1 << 0,
+    LS_FILTER_NEED_SIZE = 1 << 1,
+    LS_FILTER_NEED_MTIME = 1 << 2
+};
+
+// Prints "ls: ..." and returns NULL on a malformed expression.
+ls_filter_t *ls_filter_compile(const char *expr);
+void ls_filter_free(ls_filter_t *f);
+unsigned ls_filter_need(const ls_filter_t *f);
+// Depth limit from -maxdepth (entries of the listed directory are depth 1), -1 if none.
+int ls_filter_maxdepth(const ls_filter_t *f);
+// Whether -prune appears, so a directory the pre-stat pass rejected still
+// needs a full evaluation to know if -R may enter it.
+int ls_filter_prunes(const ls_filter_t *f);
+
+// Pre-stat pass on the name and the S_IFMT bits from d_type (0 if unknown).
+int ls_filter_pre(const ls_filter_t *f, const char *name, mode_t type);
+// Full evaluation; *prune is set when a -prune was reached.
+int ls_filter_eval(const ls_filter_t *f, const char *name, const struct stat *st, int *prune);
+
+#endif
@@ -0,0 +1,235 @@
+#include "format.h"
+#include "../common/stats.h"
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TIME_CACHE_SLOTS 64
+
+void ls_out_init(ls_out_t *out, int fd) {
+    out->fd = fd;
+    out->error = 0;
+    out->len = 0;
+}
+
+int ls_out_flush(ls_out_t *out) {
+    size_t off = 0;
+    while (off < out->len && !out->error) {
+        ssize_t n = write(out->fd, out->buf + off, out->len - off);
+        stats_add(STATS_SYS_WRITE, 1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            out->error = errno;
+            break;
+        }
+        off += (size_t)n;
+        stats_add(STATS_BYTES_WRITTEN, (uint64_t)n);
+    }
+    out->len = 0;
+    return out->error ? -1 : 0;
+}
+
+void ls_out_write(ls_out_t *out, const char *s, size_t n) {
+    while (n > 0) {
+        if (out->len == LS_OUT_BUF) ls_out_flush(out);
+        size_t k = LS_OUT_BUF - out->len;
+        if (k > n) k = n;
+        memcpy(out->buf + out->len, s, k);
+        out->len += k;
+        s += k;
+        n -= k;
+    }
+}
+
+void ls_out_str(ls_out_t *out, const char *s) {
+    ls_out_write(out, s, strlen(s));
+}
+
+static inline void out_char(ls_out_t *out, char c) {
+    if (out->len == LS_OUT_BUF) ls_out_flush(out);
+    out->buf[out->len++] = c;
+}
+
+static void out_pad(ls_out_t *out, size_t n) {
+    static const char spaces[] = "                                ";
+    while (n > 0) {
+        size_t k = n < sizeof(spaces) - 1 ? n : sizeof(spaces) - 1;
+        ls_out_write(out, spaces, k);
+        n -= k;
+    }
+}
+
+// Decimal digits of v into buf (no terminator); returns the length.
+static size_t fmt_u64(char *buf, unsigned long long v) {
+    char tmp[20];
+    size_t n = 0;
+    do {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    for (size_t i = 0; i < n; ++i) buf[i] = tmp[n - 1 - i];
+    return n;
+}
+
+// Same text as printf("%.1f%c") of the size scaled by 1024^k, in integers:
+// the remainder decides the rounding, ties go to even like printf.
+static size_t human_size(unsigned long long s, char *buf) {
+    static const char units[] = "BKMGTP";
+    int idx = 0;
+    while (idx < 5 && (s >> (10 * (idx + 1))) != 0) idx++;
+    if (idx == 0) return fmt_u64(buf, s);
+    unsigned shift = 10u * (unsigned)idx;
+    unsigned long long mask = (1ull << shift) - 1;
+    unsigned long long t = (s & mask) * 10;
+    unsigned long long tenths = (s >> shift) * 10 + (t >> shift);
+    unsigned long long r = t & mask, half = 1ull << (shift - 1);
+    if (r > half || (r == half && (tenths & 1))) tenths++;
+    size_t n = fmt_u64(buf, tenths / 10);
+    buf[n++] = '.';
+    buf[n++] = (char)('0' + tenths % 10);
+    buf[n++] = units[idx];
+    return n;
+}
+
+static void format_mode(mode_t m, char out[10]) {
+    out[0] = S_ISDIR(m) ? 'd' : S_ISLNK(m) ? 'l' : S_ISCHR(m) ? 'c' : S_ISBLK(m) ? 'b' : S_ISFIFO(m) ? 'p' : S_ISSOCK(m) ? 's' : '-';
+    out[1] = (m & S_IRUSR) ? 'r' : '-';
+    out[2] = (m & S_IWUSR) ? 'w' : '-';
+    out[3] = (m & S_IXUSR) ? ((m & S_ISUID) ? 's' : 'x') : ((m & S_ISUID) ? 'S' : '-');
+    out[4] = (m & S_IRGRP) ? 'r' : '-';
+    out[5] = (m & S_IWGRP) ? 'w' : '-';
+    out[6] = (m & S_IXGRP) ? ((m & S_ISGID) ? 's' : 'x') : ((m & S_ISGID) ? 'S' : '-');
+    out[7] = (m & S_IROTH) ? 'r' : '-';
+    out[8] = (m & S_IWOTH) ? 'w' : '-';
+    out[9] = (m & S_IXOTH) ? ((m & S_ISVTX) ? 't' : 'x') : ((m & S_ISVTX) ? 'T' : '-');
+}
+
+static char type_suffix(const struct stat *st) {
+    if (S_ISDIR(st->st_mode)) return '/';
+    if (S_ISLNK(st->st_mode)) return '@';
+    if ((st->st_mode & (S_IXUSR|S_IXGRP|S_IXOTH)) != 0) return '*';
+    return '\0';
+}
+
+typedef struct time_slot {
+    time_t start;   // first second of the minute this text is valid for
+    int valid;
+    size_t len;
+    char text[64];
+} time_slot_t;
+
+static time_slot_t time_cache[TIME_CACHE_SLOTS];
+
+// "%b %e %H:%M" only changes on minute boundaries, so one localtime_r and
+// strftime serve every mtime in [start, start + 60).
+static const time_slot_t *format_time(time_t t) {
+    time_t minute = t >= 0 ? t / 60 : (t - 59) / 60;
+    time_slot_t *s = &time_cache[(size_t)minute & (TIME_CACHE_SLOTS - 1)];
+    if (s->valid && t >= s->start && t - s->start < 60) return s;
+    struct tm lt;
+    if (!localtime_r(&t, &lt)) {
+        s->valid = 0;
+        s->len = 0;
+        return s;
+    }
+    s->start = t - lt.tm_sec;
+    s->len = strftime(s->text, sizeof(s->text), "%b %e %H:%M", &lt);
+    s->valid = 1;
+    return s;
+}
+
+static const char *owner_name(const struct stat *st, int group, const ls_options_t *opt, char idbuf[24], size_t *len) {
+    const char *name = NULL;
+    if (!opt->numeric_ids) {
+        name = group ? ls_group_name(st->st_gid) : ls_user_name(st->st_uid);
+        if (!name) name = "?";
+    } else {
+        idbuf[fmt_u64(idbuf, group ? (unsigned long long)st->st_gid : (unsigned long long)st->st_uid)] = '\0';
+        name = idbuf;
+    }
+    *len = strlen(name);
+    return name;
+}
+
+static size_t format_size(const struct stat *st, const ls_options_t *opt, char buf[32]) {
+    unsigned long long s = st->st_size > 0 ? (unsigned long long)st->st_size : 0;
+    return opt->human_readable ? human_size(s, buf) : fmt_u64(buf, s);
+}
+
+typedef struct col_widths {
+    size_t nlink, user, group, size;
+} col_widths_t;
+
+static void long_row(ls_out_t *out, const ls_entry_list_t *list, const ls_entry_t *e, const col_widths_t *w, const ls_options_t *opt) {
+    char buf[32], idbuf[24];
+    size_t len;
+
+    format_mode(e->st.st_mode, buf);
+    buf[10] = ' ';
+    ls_out_write(out, buf, 11);
+
+    len = fmt_u64(buf, (unsigned long long)e->st.st_nlink);
+    out_pad(out, w->nlink - len);
+    ls_out_write(out, buf, len);
+    out_char(out, ' ');
+
+    const char *user = owner_name(&e->st, 0, opt, idbuf, &len);
+    ls_out_write(out, user, len);
+    out_pad(out, w->user - len + 1);
+    const char *group = owner_name(&e->st, 1, opt, idbuf, &len);
+    ls_out_write(out, group, len);
+    out_pad(out, w->group - len + 1);
+
+    len = format_size(&e->st, opt, buf);
+    out_pad(out, w->size - len);
+    ls_out_write(out, buf, len);
+    out_char(out, ' ');
+
+    const time_slot_t *ts = format_time(e->st.st_mtime);
+    ls_out_write(out, ts->text, ts->len);
+    out_char(out, ' ');
+
+    ls_out_write(out, ls_entry_name(list, e), e->name_size);
+    char suffix = opt->show_file_type ? type_suffix(&e->st) : '\0';
+    if (suffix) out_char(out, suffix);
+    if (S_ISLNK(e->st.st_mode)) {
+        char linkbuf[PATH_MAX];
+        ssize_t n = readlink(ls_entry_path(list, e), linkbuf, sizeof(linkbuf));
+        ls_out_write(out, " -> ", 4);
+        if (n > 0) ls_out_write(out, linkbuf, (size_t)n);
+    }
+    out_char(out, '\n');
+}
+
+void ls_format_list(ls_out_t *out, const ls_entry_list_t *list, const ls_options_t *opt) {
+    size_t n = list->last_entry_idx;
+    if (!opt->long_format) {
+        for (size_t i = 0; i < n; ++i) {
+            const ls_entry_t *e = &list->entries[i];
+            ls_out_write(out, ls_entry_name(list, e), e->name_size);
+            char suffix = opt->show_file_type ? type_suffix(&e->st) : '\0';
+            if (suffix) out_char(out, suffix);
+            out_char(out, '\n');
+        }
+        return;
+    }
+
+    ls_use_locale(opt);
+    col_widths_t w = {0, 0, 0, 0};
+    for (size_t i = 0; i < n; ++i) {
+        const struct stat *st = &list->entries[i].st;
+        char buf[32], idbuf[24];
+        size_t len = fmt_u64(buf, (unsigned long long)st->st_nlink);
+        if (len > w.nlink) w.nlink = len;
+        owner_name(st, 0, opt, idbuf, &len);
+        if (len > w.user) w.user = len;
+        owner_name(st, 1, opt, idbuf, &len);
+        if (len > w.group) w.group = len;
+        len = format_size(st, opt, buf);
+        if (len > w.size) w.size = len;
+    }
+    for (size_t i = 0; i < n; ++i) long_row(out, list, &list->entries[i], &w, opt);
+}
@@ -0,0 +1,26 @@
+#ifndef LS_FORMAT_H
+#define LS_FORMAT_H
+#include <stddef.h>
+#include "ls.h"
+
+#define LS_OUT_BUF (64 * 1024)
+
+// Output is rendered into one large buffer and handed to write(2) when it
+// fills, so ls -l costs a syscall per 64 KiB rather than per row.
+typedef struct ls_out {
+    int fd;
+    int error;      // errno of the first failed write, 0 if none
+    size_t len;
+    char buf[LS_OUT_BUF];
+} ls_out_t;
+
+void ls_out_init(ls_out_t *out, int fd);
+void ls_out_write(ls_out_t *out, const char *s, size_t n);
+void ls_out_str(ls_out_t *out, const char *s);
+int ls_out_flush(ls_out_t *out);
+
+// Renders every entry of list; -l columns are sized to the widest value
+// in the list, like ls.
+void ls_format_list(ls_out_t *out, const ls_entry_list_t *list, const ls_options_t *opt);
+
+#endif
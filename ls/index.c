@@ -0,0 +1,408 @@
+#include "index.h"
+#include "../common/hash.h"
+#include "../common/replace.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#define INDEX_MAGIC 0x3158444e49534c55ull  // "ULSINDX1" read little-endian
+#define INDEX_VERSION 1u
+#define INDEX_MIN_CAPACITY 64u
+#define INDEX_RACY_NS 2000000000ll         // directories changed this recently are not stored
+
+typedef struct index_header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t slot_size;
+    uint32_t rec_size;
+    uint32_t reserved0;
+    uint64_t capacity;      // power of two
+    uint64_t ndirs;
+    uint64_t nrecs;
+    uint64_t names_size;
+    uint64_t reserved[4];
+} index_header_t;
+
+// One directory: its records are recs[first, first + count).
+typedef struct index_slot {
+    uint64_t dev;
+    uint64_t ino;
+    int64_t mtime_ns;
+    int64_t ctime_ns;
+    uint64_t first;
+    uint64_t count;
+    uint64_t check;         // hash of the fields above, 0 marks an empty slot
+} index_slot_t;
+
+typedef struct index_rec {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t rdev;
+    int64_t size;
+    int64_t blocks;
+    int64_t mtime_s;
+    int64_t ctime_s;
+    uint32_t mtime_nsec;
+    uint32_t ctime_nsec;
+    uint32_t mode;
+    uint32_t nlink;
+    uint32_t uid;
+    uint32_t gid;
+    uint64_t name_off;      // into the names blob, NUL-terminated
+} index_rec_t;
+
+// A directory read during this run, waiting for write-back.
+typedef struct index_dir {
+    index_slot_t key;
+    index_rec_t *recs;      // name_off relative to names
+    char *names;
+    size_t names_size;
+} index_dir_t;
+
+struct ls_index {
+    char *path;
+    void *map;
+    size_t map_size;
+    const index_slot_t *slots;  // NULL if the file was empty or invalid
+    unsigned char *seen;        // per slot, set by lookups that hit
+    const index_rec_t *recs;
+    const char *names;
+    uint64_t capacity, ndirs, nrecs, names_size;
+    index_dir_t *pending;
+    size_t npending, pending_cap;
+    pthread_mutex_t mu;
+};
+
+static uint64_t slot_check(const index_slot_t *s) {
+    uint64_t h = hash_inode(s->dev, s->ino);
+    h = hash_fold(h, (uint64_t)s->mtime_ns);
+    h = hash_fold(h, (uint64_t)s->ctime_ns);
+    h = hash_fold(h, s->first);
+    h = hash_fold(h, s->count);
+    return h | 1u;
+}
+
+static inline int64_t ts_ns(const struct timespec *ts) {
+    return (int64_t)ts->tv_sec * 1000000000ll + ts->tv_nsec;
+}
+
+static void fill_key(index_slot_t *s, const struct stat *st) {
+    memset(s, 0, sizeof(*s));
+    s->dev = (uint64_t)st->st_dev;
+    s->ino = (uint64_t)st->st_ino;
+    s->mtime_ns = ts_ns(&st->st_mtim);
+    s->ctime_ns = ts_ns(&st->st_ctim);
+}
+
+static int load_map(ls_index_t *ix) {
+    int fd = open(ix->path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(index_header_t)) {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return -1;
+    const index_header_t *h = (const index_header_t *)map;
+    uint64_t room = size - sizeof(index_header_t);
+    int ok = h->magic == INDEX_MAGIC && h->version == INDEX_VERSION &&
+             h->slot_size == sizeof(index_slot_t) && h->rec_size == sizeof(index_rec_t) &&
+             h->capacity != 0 && (h->capacity & (h->capacity - 1)) == 0 &&
+             h->capacity <= room / sizeof(index_slot_t) &&
+             h->nrecs <= (room - h->capacity * sizeof(index_slot_t)) / sizeof(index_rec_t) &&
+             h->names_size == room - h->capacity * sizeof(index_slot_t) - h->nrecs * sizeof(index_rec_t);
+    if (!ok) {
+        munmap(map, size);
+        return -1;
+    }
+    ix->map = map;
+    ix->map_size = size;
+    ix->slots = (const index_slot_t *)((const char *)map + sizeof(index_header_t));
+    ix->recs = (const index_rec_t *)(ix->slots + h->capacity);
+    ix->names = (const char *)(ix->recs + h->nrecs);
+    ix->capacity = h->capacity;
+    ix->ndirs = h->ndirs;
+    ix->nrecs = h->nrecs;
+    ix->names_size = h->names_size;
+    return 0;
+}
+
+ls_index_t *ls_index_open(const char *path) {
+    ls_index_t *ix = (ls_index_t *)calloc(1, sizeof(ls_index_t));
+    if (!ix) return NULL;
+    ix->path = strdup(path);
+    if (!ix->path) {
+        free(ix);
+        return NULL;
+    }
+    load_map(ix); // unusable: start empty, the next write-back replaces it
+    if (ix->slots) {
+        ix->seen = (unsigned char *)calloc((size_t)ix->capacity, 1);
+        if (!ix->seen) {
+            munmap(ix->map, ix->map_size);
+            free(ix->path);
+            free(ix);
+            return NULL;
+        }
+    }
+    pthread_mutex_init(&ix->mu, NULL);
+    return ix;
+}
+
+static void rec_to_stat(const index_rec_t *r, struct stat *st) {
+    memset(st, 0, sizeof(*st));
+    st->st_dev = (dev_t)r->dev;
+    st->st_ino = (ino_t)r->ino;
+    st->st_rdev = (dev_t)r->rdev;
+    st->st_size = (off_t)r->size;
+    st->st_blocks = (blkcnt_t)r->blocks;
+    st->st_mtim.tv_sec = (time_t)r->mtime_s;
+    st->st_mtim.tv_nsec = r->mtime_nsec;
+    st->st_ctim.tv_sec = (time_t)r->ctime_s;
+    st->st_ctim.tv_nsec = r->ctime_nsec;
+    st->st_mode = (mode_t)r->mode;
+    st->st_nlink = (nlink_t)r->nlink;
+    st->st_uid = (uid_t)r->uid;
+    st->st_gid = (gid_t)r->gid;
+}
+
+static void stat_to_rec(const struct stat *st, uint64_t name_off, index_rec_t *r) {
+    memset(r, 0, sizeof(*r));
+    r->dev = (uint64_t)st->st_dev;
+    r->ino = (uint64_t)st->st_ino;
+    r->rdev = (uint64_t)st->st_rdev;
+    r->size = (int64_t)st->st_size;
+    r->blocks = (int64_t)st->st_blocks;
+    r->mtime_s = (int64_t)st->st_mtim.tv_sec;
+    r->mtime_nsec = (uint32_t)st->st_mtim.tv_nsec;
+    r->ctime_s = (int64_t)st->st_ctim.tv_sec;
+    r->ctime_nsec = (uint32_t)st->st_ctim.tv_nsec;
+    r->mode = (uint32_t)st->st_mode;
+    r->nlink = (uint32_t)st->st_nlink;
+    r->uid = (uint32_t)st->st_uid;
+    r->gid = (uint32_t)st->st_gid;
+    r->name_off = name_off;
+}
+
+// Whether an old slot's record range and names lie inside the mapping; a
+// corrupt file must not send a lookup or the write-back outside it.
+static int slot_in_bounds(const ls_index_t *ix, const index_slot_t *s) {
+    if (s->first > ix->nrecs || s->count > ix->nrecs - s->first) return 0;
+    for (uint64_t r = s->first; r < s->first + s->count; ++r) {
+        if (ix->recs[r].name_off >= ix->names_size) return 0;
+    }
+    return 1;
+}
+
+int ls_index_lookup(ls_index_t *ix, const struct stat *dir_st, ls_index_fn fn, void *ctx) {
+    if (!ix || !ix->slots) return -1;
+    index_slot_t key;
+    fill_key(&key, dir_st);
+    uint64_t mask = ix->capacity - 1;
+    uint64_t i = hash_inode(key.dev, key.ino) & mask;
+    for (uint64_t probes = 0; probes < ix->capacity; ++probes, i = (i + 1) & mask) {
+        const index_slot_t *s = &ix->slots[i];
+        if (s->check == 0) return -1;
+        if (s->dev != key.dev || s->ino != key.ino) continue;
+        if (s->check != slot_check(s)) return -1;
+        if (s->mtime_ns != key.mtime_ns || s->ctime_ns != key.ctime_ns) return -1;
+        if (!slot_in_bounds(ix, s)) return -1;
+        if (ix->names_size > 0 && ix->names[ix->names_size - 1] != '\0') return -1;
+        __atomic_store_n(&ix->seen[i], 1, __ATOMIC_RELAXED);
+        for (uint64_t r = s->first; r < s->first + s->count; ++r) {
+            struct stat st;
+            rec_to_stat(&ix->recs[r], &st);
+            fn(ix->names + ix->recs[r].name_off, &st, ctx);
+        }
+        return 0;
+    }
+    return -1;
+}
+
+void ls_index_store(ls_index_t *ix, const struct stat *before, const struct stat *after, const ls_entry_list_t *entries) {
+    if (!ix) return;
+    index_dir_t d;
+    index_slot_t k2;
+    fill_key(&d.key, before);
+    fill_key(&k2, after);
+    if (memcmp(&d.key, &k2, sizeof(k2)) != 0) return; // changed while we read it
+    // A name created just after readdir can share the directory's mtime
+    // granule and go unnoticed, so directories this fresh are not stored.
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    int64_t newest = d.key.mtime_ns > d.key.ctime_ns ? d.key.mtime_ns : d.key.ctime_ns;
+    if (ts_ns(&now) - newest < INDEX_RACY_NS) return;
+
+    size_t n = entries->last_entry_idx, names_size = 0;
+    for (size_t i = 0; i < n; ++i) names_size += entries->entries[i].name_size + 1;
+    d.recs = (index_rec_t *)malloc((n ? n : 1) * sizeof(index_rec_t));
+    d.names = (char *)malloc(names_size ? names_size : 1);
+    if (!d.recs || !d.names) {
+        free(d.recs); free(d.names);
+        return;
+    }
+    size_t off = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const ls_entry_t *e = &entries->entries[i];
+        memcpy(d.names + off, ls_entry_name(entries, e), e->name_size + 1);
+        stat_to_rec(&e->st, off, &d.recs[i]);
+        off += e->name_size + 1;
+    }
+    d.names_size = names_size;
+    d.key.count = n;
+
+    pthread_mutex_lock(&ix->mu);
+    if (ix->npending == ix->pending_cap) {
+        size_t cap = ix->pending_cap ? ix->pending_cap * 2 : 64;
+        index_dir_t *p = (index_dir_t *)realloc(ix->pending, cap * sizeof(index_dir_t));
+        if (!p) {
+            pthread_mutex_unlock(&ix->mu);
+            free(d.recs); free(d.names);
+            return;
+        }
+        ix->pending = p;
+        ix->pending_cap = cap;
+    }
+    ix->pending[ix->npending++] = d;
+    pthread_mutex_unlock(&ix->mu);
+}
+
+// Where a directory of the new file comes from: pending[idx] or old slot idx.
+typedef struct index_src {
+    index_slot_t key;
+    int fresh;
+    size_t idx;
+} index_src_t;
+
+static void src_put(index_src_t *table, uint64_t capacity, const index_src_t *e, int overwrite) {
+    uint64_t mask = capacity - 1;
+    for (uint64_t i = hash_inode(e->key.dev, e->key.ino) & mask;; i = (i + 1) & mask) {
+        index_src_t *t = &table[i];
+        if (t->key.check == 0) {
+            *t = *e;
+            return;
+        }
+        if (t->key.dev == e->key.dev && t->key.ino == e->key.ino) {
+            if (overwrite) *t = *e;
+            return;
+        }
+    }
+}
+
+typedef struct index_out {
+    const ls_index_t *ix;
+    const index_src_t *table;
+    uint64_t capacity, ndirs, nrecs, names_size;
+} index_out_t;
+
+static void fill_index(void *map, void *ctx) {
+    const index_out_t *o = (const index_out_t *)ctx;
+    const ls_index_t *ix = o->ix;
+    index_header_t *h = (index_header_t *)map;
+    index_slot_t *slots = (index_slot_t *)((char *)map + sizeof(index_header_t));
+    index_rec_t *recs = (index_rec_t *)(slots + o->capacity);
+    char *names = (char *)(recs + o->nrecs);
+    uint64_t rec_at = 0, name_at = 0;
+    for (uint64_t i = 0; i < o->capacity; ++i) {
+        const index_src_t *t = &o->table[i];
+        if (t->key.check == 0) continue;
+        index_slot_t *s = &slots[i];
+        *s = t->key;
+        s->first = rec_at;
+        for (uint64_t r = 0; r < t->key.count; ++r) {
+            const index_rec_t *src;
+            const char *name;
+            if (t->fresh) {
+                src = &ix->pending[t->idx].recs[r];
+                name = ix->pending[t->idx].names + src->name_off;
+            } else {
+                src = &ix->recs[t->key.first + r];
+                name = ix->names + src->name_off;
+            }
+            size_t len = t->fresh ? strlen(name) : strnlen(name, ix->names_size - src->name_off);
+            recs[rec_at] = *src;
+            recs[rec_at++].name_off = name_at;
+            memcpy(names + name_at, name, len);
+            names[name_at + len] = '\0';
+            name_at += len + 1;
+        }
+        s->check = slot_check(s);
+    }
+    h->magic = INDEX_MAGIC;
+    h->version = INDEX_VERSION;
+    h->slot_size = sizeof(index_slot_t);
+    h->rec_size = sizeof(index_rec_t);
+    h->capacity = o->capacity;
+    h->ndirs = o->ndirs;
+    h->nrecs = o->nrecs;
+    h->names_size = o->names_size;
+}
+
+// Keeps the directories read or hit during this run; slots of directories
+// that were deleted, renamed or not listed this time are dropped.
+static int write_back(ls_index_t *ix) {
+    uint64_t kept = 0;
+    for (uint64_t i = 0; ix->slots && i < ix->capacity; ++i) kept += ix->seen[i];
+    uint64_t want = (kept + (uint64_t)ix->npending) * 2;
+    uint64_t capacity = INDEX_MIN_CAPACITY;
+    while (capacity < want) capacity <<= 1;
+    index_src_t *table = (index_src_t *)calloc(capacity, sizeof(index_src_t));
+    if (!table) return -1;
+    // Later reads of the same directory win, then older entries fill in.
+    for (size_t i = ix->npending; i-- > 0;) {
+        index_src_t e = {ix->pending[i].key, 1, i};
+        e.key.check = 1;
+        src_put(table, capacity, &e, 0);
+    }
+    for (uint64_t i = 0; ix->slots && i < ix->capacity; ++i) {
+        const index_slot_t *s = &ix->slots[i];
+        if (!ix->seen[i] || s->check != slot_check(s)) continue;
+        if (!slot_in_bounds(ix, s)) continue;
+        index_src_t e = {*s, 0, (size_t)i};
+        src_put(table, capacity, &e, 0);
+    }
+    index_out_t o = { ix, table, capacity, 0, 0, 0 };
+    for (uint64_t i = 0; i < capacity; ++i) {
+        const index_src_t *t = &table[i];
+        if (t->key.check == 0) continue;
+        o.ndirs++;
+        o.nrecs += t->key.count;
+        if (t->fresh) {
+            o.names_size += ix->pending[t->idx].names_size;
+        } else {
+            for (uint64_t r = t->key.first; r < t->key.first + t->key.count; ++r) {
+                o.names_size += strnlen(ix->names + ix->recs[r].name_off, ix->names_size - ix->recs[r].name_off) + 1;
+            }
+        }
+    }
+    size_t size = sizeof(index_header_t) + (size_t)capacity * sizeof(index_slot_t) +
+                  (size_t)o.nrecs * sizeof(index_rec_t) + (size_t)o.names_size;
+    int ret = replace_mapped(ix->path, size, fill_index, &o, "ls: index");
+    free(table);
+    return ret;
+}
+
+int ls_index_close(ls_index_t *ix) {
+    if (!ix) return 0;
+    int ret = 0;
+    if (ix->npending > 0) ret = write_back(ix);
+    if (ix->map) munmap(ix->map, ix->map_size);
+    pthread_mutex_destroy(&ix->mu);
+    free(ix->seen);
+    for (size_t i = 0; i < ix->npending; ++i) {
+        free(ix->pending[i].recs);
+        free(ix->pending[i].names);
+    }
+    free(ix->pending);
+    free(ix->path);
+    free(ix);
+    return ret;
+}
@@ -0,0 +1,29 @@
+#ifndef LS_INDEX_H
+#define LS_INDEX_H
+#include <sys/stat.h>
+#include "ls.h"
+
+// On-disk directory index keyed on the directory's (st_dev, st_ino) and
+// validated by its mtime and ctime. Each directory keeps every name with
+// its stat fields, so one stat of an unchanged directory replaces readdir
+// and a stat per entry. Files whose attributes change without touching the
+// directory (a rewrite in place, chmod) are served stale until the
+// directory itself changes.
+// Lookups read a read-only mapping and are safe from any thread; stores
+// are kept in memory and written back by ls_index_close via a temporary
+// file and rename, together with the old slots lookups hit; the rest are
+// dropped.
+typedef struct ls_index ls_index_t;
+
+typedef void (*ls_index_fn)(const char *name, const struct stat *st, void *ctx);
+
+// A missing or unreadable index yields an empty one; NULL only on ENOMEM.
+ls_index_t *ls_index_open(const char *path);
+// Calls fn for every stored entry and returns 0 if dir_st still matches.
+int ls_index_lookup(ls_index_t *ix, const struct stat *dir_st, ls_index_fn fn, void *ctx);
+// entries must be complete (all names, full stats); before/after are the
+// directory's metadata around the read, nothing is stored if they differ.
+void ls_index_store(ls_index_t *ix, const struct stat *before, const struct stat *after, const ls_entry_list_t *entries);
+int ls_index_close(ls_index_t *ix);
+
+#endif
@@ -1,16 +1,62 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // statx
+#endif
 #include "ls.h"
+#include "filter.h"
+#include "index.h"
+#include "../common/stats.h"
 #include <dirent.h>
 #include <errno.h>
+#include <grp.h>
 #include <limits.h>
+#include <locale.h>
+#include <pthread.h>
+#include <pwd.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+#endif
+
+#ifndef DTTOIF
+#define DTTOIF(dirtype) ((dirtype) << 12)
+#endif
 
 static inline void list_init(ls_entry_list_t *list) {
     list->entries = NULL;
     list->last_entry_idx = 0;
     list->capacity = 0;
+    list->pool = NULL;
+    list->pool_size = 0;
+    list->pool_cap = 0;
+}
+
+// Drops the entries but keeps both allocations for reuse.
+static inline void list_clear(ls_entry_list_t *list) {
+    list->last_entry_idx = 0;
+    list->pool_size = 0;
+}
+
+static void list_free(ls_entry_list_t *list) {
+    free(list->entries);
+    free(list->pool);
+    list_init(list);
+}
+
+// Removes entries that were only kept for traversal.
+static void drop_unlisted(ls_entry_list_t *list) {
+    size_t j = 0;
+    for (size_t i = 0; i < list->last_entry_idx; ++i) {
+        if (list->entries[i].flags & LS_ENTRY_UNLISTED) continue;
+        if (j != i) list->entries[j] = list->entries[i];
+        j++;
+    }
+    list->last_entry_idx = j;
 }
 
 static int list_ensure_capacity(ls_entry_list_t *list, size_t min_cap) {
@@ -24,183 +70,697 @@ static int list_ensure_capacity(ls_entry_list_t *list, size_t min_cap) {
     return 0;
 }
 
+// Bump-allocates len bytes from the list's string pool and returns the offset.
+// The pool may move, which is why entries keep offsets rather than pointers.
+static int pool_reserve(ls_entry_list_t *list, size_t len, size_t *off) {
+    if (list->pool_size + len > list->pool_cap) {
+        size_t new_cap = list->pool_cap ? list->pool_cap * 2 : 4096;
+        while (new_cap < list->pool_size + len) new_cap *= 2;
+        char *new_pool = (char *)realloc(list->pool, new_cap);
+        if (!new_pool) return -1;
+        list->pool = new_pool;
+        list->pool_cap = new_cap;
+    }
+    *off = list->pool_size;
+    list->pool_size += len;
+    return 0;
+}
+
 static inline int is_dot_or_dotdot(const char *name) {
     return (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')));
 }
 
-static char *join_path(const char *base, const char *name) {
-    size_t bl = strlen(base);
-    size_t nl = strlen(name);
-    int need_slash = (bl > 0 && base[bl - 1] != '/');
-    size_t len = bl + (need_slash ? 1 : 0) + nl + 1;
-    char *buf = (char *)malloc(len);
-    if (!buf) return NULL;
-    memcpy(buf, base, bl);
-    if (need_slash) buf[bl] = '/';
-    memcpy(buf + bl + (need_slash ? 1 : 0), name, nl);
-    buf[len - 1] = '\0';
-    return buf;
-}
-
-static int append_entry(ls_entry_list_t *list, const char *name, const char *full_path, const struct stat *st) {
+// Stores "prefix" "name" once; the entry's name is the tail of its path.
+static int append_entry(ls_entry_list_t *list, const char *prefix, size_t prefix_len, const char *name, const struct stat *st, int stat_valid) {
     if (list_ensure_capacity(list, list->last_entry_idx + 1) != 0) return -1;
+    size_t nl = strlen(name);
+    size_t off;
+    if (pool_reserve(list, prefix_len + nl + 1, &off) != 0) return -1;
+    memcpy(list->pool + off, prefix, prefix_len);
+    memcpy(list->pool + off + prefix_len, name, nl + 1);
     ls_entry_t *e = &list->entries[list->last_entry_idx];
-    e->name = strdup(name);
-    if (!e->name) return -1;
-    e->name_size = strlen(name);
-    e->full_path = strdup(full_path);
-    if (!e->full_path) {
-        free(e->name);
-        return -1;
-    }
-    e->full_path_size = strlen(full_path);
+    e->full_path_off = off;
+    e->full_path_size = prefix_len + nl;
+    e->name_off = off + prefix_len;
+    e->name_size = nl;
     e->st = *st;
+    e->stat_valid = stat_valid;
+    e->flags = 0;
     list->last_entry_idx += 1;
     return 0;
 }
 
-static int should_include(const ls_options_t *opt, const char *name, const struct stat *st) {
-    if (!opt->show_all_files && name[0] == '.') return 0;
-    if (opt->directory_only && !S_ISDIR(st->st_mode)) return 0;
-    return 1;
+static inline int include_name(const ls_options_t *opt, const char *name) {
+    return opt->show_all_files || name[0] != '.';
+}
+
+static inline int include_stat(const ls_options_t *opt, const struct stat *st) {
+    return !opt->directory_only || S_ISDIR(st->st_mode);
+}
+
+// Asked for every directory read, and sysconf reads /sys each time.
+static size_t resolve_jobs(const ls_options_t *opt) {
+    static size_t cached;
+    if (opt->jobs > 0) return (size_t)opt->jobs;
+    size_t cpus = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+    if (cpus == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        cpus = n < 1 ? 1 : (size_t)n;
+        __atomic_store_n(&cached, cpus, __ATOMIC_RELAXED);
+    }
+    return cpus;
+}
+
+// Stat fields the active options actually look at.
+enum {
+    LS_NEED_TYPE  = 1 << 0,
+    LS_NEED_MODE  = 1 << 1,
+    LS_NEED_NLINK = 1 << 2,
+    LS_NEED_OWNER = 1 << 3,
+    LS_NEED_SIZE  = 1 << 4,
+    LS_NEED_MTIME = 1 << 5,
+    LS_NEED_BLOCKS = 1 << 6
+};
+
+// LS_NEED_TYPE alone is answered by d_type when the filesystem fills it in.
+static unsigned stat_need(const ls_options_t *opt) {
+    unsigned need = 0;
+    if (opt->long_format) need |= LS_NEED_TYPE | LS_NEED_MODE | LS_NEED_NLINK | LS_NEED_OWNER | LS_NEED_SIZE | LS_NEED_MTIME;
+    if (opt->show_file_type) need |= LS_NEED_TYPE | LS_NEED_MODE;
+    if (opt->sort_key == LS_SORT_TIME) need |= LS_NEED_TYPE | LS_NEED_MTIME;
+    if (opt->sort_key == LS_SORT_SIZE) need |= LS_NEED_TYPE | LS_NEED_SIZE;
+    if (opt->directory_only) need |= LS_NEED_TYPE;
+    if (opt->want_blocks) need |= LS_NEED_TYPE | LS_NEED_NLINK | LS_NEED_SIZE | LS_NEED_BLOCKS;
+    if (opt->filter) {
+        unsigned fneed = ls_filter_need(opt->filter);
+        if (fneed & LS_FILTER_NEED_TYPE) need |= LS_NEED_TYPE;
+        if (fneed & LS_FILTER_NEED_SIZE) need |= LS_NEED_TYPE | LS_NEED_SIZE;
+        if (fneed & LS_FILTER_NEED_MTIME) need |= LS_NEED_TYPE | LS_NEED_MTIME;
+    }
+    return need;
+}
+
+#if defined(__linux__) && defined(STATX_BASIC_STATS)
+static int statx_missing = 0;
+
+static unsigned to_statx_mask(unsigned need) {
+    unsigned mask = STATX_TYPE;
+    if (need & LS_NEED_MODE) mask |= STATX_MODE;
+    if (need & LS_NEED_NLINK) mask |= STATX_NLINK;
+    if (need & LS_NEED_OWNER) mask |= STATX_UID | STATX_GID;
+    if (need & LS_NEED_SIZE) mask |= STATX_SIZE;
+    if (need & LS_NEED_MTIME) mask |= STATX_MTIME;
+    if (need & LS_NEED_BLOCKS) mask |= STATX_BLOCKS;
+    return mask;
+}
+
+static void statx_to_stat(const struct statx *sx, struct stat *st) {
+    memset(st, 0, sizeof(*st));
+    st->st_dev = makedev(sx->stx_dev_major, sx->stx_dev_minor);
+    st->st_ino = sx->stx_ino;
+    st->st_mode = sx->stx_mode;
+    st->st_nlink = sx->stx_nlink;
+    st->st_uid = sx->stx_uid;
+    st->st_gid = sx->stx_gid;
+    st->st_rdev = makedev(sx->stx_rdev_major, sx->stx_rdev_minor);
+    st->st_size = (off_t)sx->stx_size;
+    st->st_blksize = sx->stx_blksize;
+    st->st_blocks = (blkcnt_t)sx->stx_blocks;
+    st->st_atim.tv_sec = sx->stx_atime.tv_sec;
+    st->st_atim.tv_nsec = sx->stx_atime.tv_nsec;
+    st->st_mtim.tv_sec = sx->stx_mtime.tv_sec;
+    st->st_mtim.tv_nsec = sx->stx_mtime.tv_nsec;
+    st->st_ctim.tv_sec = sx->stx_ctime.tv_sec;
+    st->st_ctim.tv_nsec = sx->stx_ctime.tv_nsec;
+}
+#endif
+
+// Stats name relative to dirfd, so the kernel resolves one component
+// instead of the whole path, asking only for the fields in need.
+static int stat_at(int dirfd, const char *name, unsigned need, struct stat *st) {
+    stats_add(STATS_SYS_STAT, 1);
+#if defined(__linux__) && defined(STATX_BASIC_STATS)
+    if (!statx_missing) {
+        struct statx sx;
+        if (statx(dirfd, name, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT, to_statx_mask(need), &sx) == 0) {
+            statx_to_stat(&sx, st);
+            return 0;
+        }
+        if (errno != ENOSYS) return -1;
+        statx_missing = 1;
+    }
+#else
+    (void)need;
+#endif
+    return fstatat(dirfd, name, st, AT_SYMLINK_NOFOLLOW);
+}
+
+// "dir/" prefix shared by every entry of one directory.
+typedef struct path_buf {
+    char *buf;
+    size_t base_len;
+} path_buf_t;
+
+static int path_buf_init(path_buf_t *pb, const char *dir) {
+    size_t dl = strlen(dir);
+    int need_slash = (dl > 0 && dir[dl - 1] != '/');
+    pb->buf = (char *)malloc(dl + 2);
+    if (!pb->buf) return -1;
+    memcpy(pb->buf, dir, dl);
+    if (need_slash) pb->buf[dl++] = '/';
+    pb->buf[dl] = '\0';
+    pb->base_len = dl;
+    return 0;
+}
+
+#define LS_STAT_PENDING (-1)    // stat_valid while a deferred stat is outstanding
+#define LS_STAT_FAILED (-2)
+#define LS_STAT_FANOUT_MIN 1024 // deferred stats before threads are used
+#define LS_STAT_CHUNK 64        // entries claimed per grab
+#define LS_STAT_MAX_THREADS 256
+
+// Verdict once st is known: 0 drops the entry. With a filter, directories
+// that fail it are kept as LS_ENTRY_UNLISTED while -R still has to walk
+// into them, and -prune/-maxdepth mark directories LS_ENTRY_NO_DESCEND.
+static int keep_entry(const ls_options_t *opt, int depth, const char *name, const struct stat *st, unsigned *flags) {
+    if (!include_stat(opt, st)) return 0;
+    const ls_filter_t *f = opt->filter;
+    if (!f) return 1;
+    int maxdepth = ls_filter_maxdepth(f);
+    if (maxdepth >= 0 && depth > maxdepth) return 0;
+    int prune = 0;
+    if (!(*flags & LS_ENTRY_UNLISTED)) {
+        if (ls_filter_eval(f, name, st, &prune) != LS_FILTER_TRUE) *flags |= LS_ENTRY_UNLISTED;
+    } else if (S_ISDIR(st->st_mode) && ls_filter_prunes(f)) {
+        ls_filter_eval(f, name, st, &prune); // listing is settled, only -prune counts
+    }
+    if (!S_ISDIR(st->st_mode)) return !(*flags & LS_ENTRY_UNLISTED);
+    if (prune || (maxdepth >= 0 && depth >= maxdepth)) *flags |= LS_ENTRY_NO_DESCEND;
+    if (!(*flags & LS_ENTRY_UNLISTED)) return 1;
+    return opt->recursive_listing && !(*flags & LS_ENTRY_NO_DESCEND);
+}
+
+// Filters and adds one directory entry at the given depth. Hidden names
+// and names the filter rejects outright are dropped before any stat; stat
+// runs only when the options need more than d_type or the filesystem did
+// not fill it in. With defer, the stat is left to stat_pending.
+static int add_dirent(int dirfd, const path_buf_t *pb, const char *name, unsigned char d_type, unsigned need, int defer, int depth, const ls_options_t *opt, ls_entry_list_t *out) {
+    if (!include_name(opt, name)) return 0;
+    unsigned flags = 0;
+    if (opt->filter) {
+        mode_t type = d_type == DT_UNKNOWN ? 0 : DTTOIF(d_type);
+        if (ls_filter_pre(opt->filter, name, type) == LS_FILTER_FALSE) {
+            if (!opt->recursive_listing || (type && !S_ISDIR(type))) return 0;
+            flags = LS_ENTRY_UNLISTED;
+            if (!ls_filter_prunes(opt->filter)) need = 0; // only its type matters now
+        }
+    }
+    struct stat st;
+    int stat_valid = 0;
+    if ((need & ~(unsigned)LS_NEED_TYPE) || d_type == DT_UNKNOWN) {
+        if (defer) {
+            memset(&st, 0, sizeof(st));
+            stat_valid = LS_STAT_PENDING;
+        } else {
+            if (stat_at(dirfd, name, need | LS_NEED_TYPE, &st) != 0) return 0;
+            stat_valid = 1;
+        }
+    } else {
+        memset(&st, 0, sizeof(st));
+        st.st_mode = DTTOIF(d_type);
+    }
+    if (stat_valid != LS_STAT_PENDING && !keep_entry(opt, depth, name, &st, &flags)) return 0;
+    if (append_entry(out, pb->buf, pb->base_len, name, &st, stat_valid) != 0) {
+        errno = ENOMEM;
+        return -1;
+    }
+    out->entries[out->last_entry_idx - 1].flags = flags;
+    return 0;
+}
+
+typedef struct stat_fanout {
+    int dirfd;
+    unsigned need;
+    ls_entry_list_t *list;
+    size_t end;
+    size_t next;    // next unclaimed index, taken with an atomic add
+} stat_fanout_t;
+
+static void *stat_fanout_worker(void *arg) {
+    stat_fanout_t *f = (stat_fanout_t *)arg;
+    double t0 = stats_now();
+    size_t done = 0;
+    for (;;) {
+        size_t i = __atomic_fetch_add(&f->next, LS_STAT_CHUNK, __ATOMIC_RELAXED);
+        if (i >= f->end) break;
+        size_t stop = f->end - i > LS_STAT_CHUNK ? i + LS_STAT_CHUNK : f->end;
+        for (; i < stop; ++i) {
+            ls_entry_t *e = &f->list->entries[i];
+            if (e->stat_valid != LS_STAT_PENDING) continue;
+            int rc = stat_at(f->dirfd, ls_entry_name(f->list, e), f->need | LS_NEED_TYPE, &e->st);
+            e->stat_valid = rc == 0 ? 1 : LS_STAT_FAILED;
+            done++;
+        }
+    }
+    if (stats_enabled) stats_chunk("stat", stats_now() - t0, done);
+    return NULL;
+}
+
+// Runs the stats deferred since index begin. On high-latency filesystems
+// each stat is a round trip, so large batches are spread over up to -j
+// threads; the list is not touched by anyone else meanwhile. Entries that
+// vanished or fail the stat-based filter are then squeezed out.
+static void stat_pending(int dirfd, unsigned need, int depth, const ls_options_t *opt, ls_entry_list_t *list, size_t begin) {
+    size_t n = list->last_entry_idx, pending = 0;
+    for (size_t i = begin; i < n; ++i) pending += list->entries[i].stat_valid == LS_STAT_PENDING;
+    if (pending == 0) return;
+    stat_fanout_t f = {dirfd, need, list, n, begin};
+    size_t nthreads = 0;
+    pthread_t ths[LS_STAT_MAX_THREADS];
+    if (pending >= LS_STAT_FANOUT_MIN) {
+        nthreads = resolve_jobs(opt) - 1;
+        if (nthreads > LS_STAT_MAX_THREADS) nthreads = LS_STAT_MAX_THREADS;
+        if (nthreads > pending / LS_STAT_CHUNK) nthreads = pending / LS_STAT_CHUNK;
+    }
+    size_t started = 0;
+    while (started < nthreads && pthread_create(&ths[started], NULL, stat_fanout_worker, &f) == 0) started++;
+    stats_engine("stat", started ? "fanout" : "serial");
+    stat_fanout_worker(&f);
+    for (size_t i = 0; i < started; ++i) pthread_join(ths[i], NULL);
+
+    size_t j = begin;
+    for (size_t i = begin; i < n; ++i) {
+        ls_entry_t *e = &list->entries[i];
+        if (e->stat_valid == LS_STAT_FAILED) continue;
+        if (!keep_entry(opt, depth, ls_entry_name(list, e), &e->st, &e->flags)) continue;
+        if (j != i) list->entries[j] = *e;
+        j++;
+    }
+    list->last_entry_idx = j;
+}
+
+#if defined(__linux__)
+struct linux_dirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+#define LS_GETDENTS_BUF (256 * 1024)
+
+// Pulls entries in large getdents64 batches instead of one readdir at a time.
+// With a batch callback, out is handed over and emptied after every batch.
+static int read_dir_batched(const char *path, int depth, const ls_options_t *opt, ls_entry_list_t *out, ls_batch_fn batch, void *ctx) {
+    int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    stats_add(STATS_SYS_OPEN, 1);
+    if (fd < 0) return -1;
+    char *buf = (char *)malloc(LS_GETDENTS_BUF);
+    path_buf_t pb;
+    if (!buf || path_buf_init(&pb, path) != 0) {
+        free(buf);
+        close(fd);
+        errno = ENOMEM;
+        return -1;
+    }
+    unsigned need = stat_need(opt);
+    int defer = resolve_jobs(opt) > 1;
+    size_t begin = out->last_entry_idx;
+    int ret = 0;
+    for (;;) {
+        long n = syscall(SYS_getdents64, fd, buf, LS_GETDENTS_BUF);
+        stats_add(STATS_SYS_GETDENTS, 1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ret = -1;
+            break;
+        }
+        if (n == 0) break;
+        for (long off = 0; off < n;) {
+            struct linux_dirent64 *de = (struct linux_dirent64 *)(buf + off);
+            off += de->d_reclen;
+            if (add_dirent(fd, &pb, de->d_name, de->d_type, need, defer, depth, opt, out) != 0) {
+                ret = -1;
+                break;
+            }
+        }
+        if (ret != 0) break;
+        if (batch) {
+            stat_pending(fd, need, depth, opt, out, begin);
+            drop_unlisted(out);
+            if (out->last_entry_idx > 0) batch(path, out, ctx);
+            list_clear(out);
+            begin = 0;
+        }
+    }
+    int saved = errno;
+    stat_pending(fd, need, depth, opt, out, begin);
+    free(pb.buf);
+    free(buf);
+    close(fd);
+    errno = saved;
+    return ret;
 }
+#else
+#define LS_READDIR_BATCH 1024
 
-static int read_dir_raw(const char *path, ls_entry_list_t *out) {
+static int read_dir_batched(const char *path, int depth, const ls_options_t *opt, ls_entry_list_t *out, ls_batch_fn batch, void *ctx) {
     DIR *dir = opendir(path);
+    stats_add(STATS_SYS_OPEN, 1);
     if (!dir) return -1;
+    path_buf_t pb;
+    if (path_buf_init(&pb, path) != 0) {
+        closedir(dir);
+        errno = ENOMEM;
+        return -1;
+    }
+    unsigned need = stat_need(opt);
+    int defer = resolve_jobs(opt) > 1;
+    size_t begin = out->last_entry_idx;
+    int ret = 0;
     struct dirent *de;
     errno = 0;
     while ((de = readdir(dir)) != NULL) {
-        char *full = join_path(path, de->d_name);
-        if (!full) { errno = ENOMEM; break; }
-        struct stat st;
-        if (lstat(full, &st) != 0) {
-            free(full);
-            continue;
-        }
-        if (append_entry(out, de->d_name, full, &st) != 0) {
-            free(full);
-            errno = ENOMEM;
+#ifdef DT_UNKNOWN
+        unsigned char d_type = de->d_type;
+#else
+        unsigned char d_type = 0;
+        need |= LS_NEED_TYPE;
+#endif
+        if (add_dirent(dirfd(dir), &pb, de->d_name, d_type, need, defer, depth, opt, out) != 0) {
+            ret = -1;
             break;
         }
-        free(full);
+        if (batch && out->last_entry_idx >= LS_READDIR_BATCH) {
+            stat_pending(dirfd(dir), need, depth, opt, out, begin);
+            drop_unlisted(out);
+            batch(path, out, ctx);
+            list_clear(out);
+            begin = 0;
+        }
     }
     int saved = errno;
+    stat_pending(dirfd(dir), need, depth, opt, out, begin);
+    if (batch) drop_unlisted(out);
+    if (ret == 0 && batch && out->last_entry_idx > 0) {
+        batch(path, out, ctx);
+        list_clear(out);
+    }
+    free(pb.buf);
     closedir(dir);
     errno = saved;
     if (de == NULL && saved != 0) return -1;
-    return 0;
-}
-
-static int cmp_name(const void *a, const void *b) {
-    const ls_entry_t *ea = (const ls_entry_t *)a;
-    const ls_entry_t *eb = (const ls_entry_t *)b;
-    return strcoll(ea->name, eb->name);
+    return ret;
 }
+#endif
 
-static int cmp_time(const void *a, const void *b) {
-    const ls_entry_t *ea = (const ls_entry_t *)a;
-    const ls_entry_t *eb = (const ls_entry_t *)b;
-    if (ea->st.st_mtime == eb->st.st_mtime) return strcoll(ea->name, eb->name);
-    return (ea->st.st_mtime < eb->st.st_mtime) ? 1 : -1;
-}
+typedef struct replay {
+    const ls_options_t *opt;
+    int depth;
+    path_buf_t pb;
+    ls_entry_list_t *out;
+    int error;
+} replay_t;
 
-static int cmp_size(const void *a, const void *b) {
-    const ls_entry_t *ea = (const ls_entry_t *)a;
-    const ls_entry_t *eb = (const ls_entry_t *)b;
-    if (ea->st.st_size == eb->st.st_size) return strcoll(ea->name, eb->name);
-    return (ea->st.st_size < eb->st.st_size) ? 1 : -1;
+// Applies the caller's options to one complete, fully statted entry.
+static void replay_entry(const char *name, const struct stat *st, void *ctx) {
+    replay_t *r = (replay_t *)ctx;
+    if (r->error || !include_name(r->opt, name)) return;
+    unsigned flags = 0;
+    if (!keep_entry(r->opt, r->depth, name, st, &flags)) return;
+    if (append_entry(r->out, r->pb.buf, r->pb.base_len, name, st, 1) != 0) {
+        r->error = 1;
+        return;
+    }
+    r->out->entries[r->out->last_entry_idx - 1].flags = flags;
 }
 
-static void sort_entries(ls_entry_list_t *list, const ls_options_t *opt) {
-    if (list->last_entry_idx <= 1) return;
-    int (*cmp)(const void *, const void *) = cmp_name;
-    if (opt->sort_key == LS_SORT_TIME) cmp = cmp_time;
-    else if (opt->sort_key == LS_SORT_SIZE) cmp = cmp_size;
-    qsort(list->entries, list->last_entry_idx, sizeof(ls_entry_t), cmp);
-    if (opt->reverse) {
-        size_t n = list->last_entry_idx;
-        for (size_t i = 0; i < n / 2; ++i) {
-            ls_entry_t tmp = list->entries[i];
-            list->entries[i] = list->entries[n - 1 - i];
-            list->entries[n - 1 - i] = tmp;
-        }
-    }
-}
-
-static int collect_filtered(const char *path, const ls_options_t *opt, ls_entry_list_t *out) {
-    ls_entry_list_t tmp;
-    list_init(&tmp);
-    if (read_dir_raw(path, &tmp) != 0) {
-        if (tmp.entries) {
-            for (size_t i = 0; i < tmp.last_entry_idx; ++i) {
-                free(tmp.entries[i].name);
-                free(tmp.entries[i].full_path);
-            }
-            free(tmp.entries);
-        }
+// With an index, an unchanged directory costs one stat. Anything else is
+// read with every name and every stat field so that what gets stored
+// serves later runs whatever their options are.
+static int read_dir_indexed(const char *path, int depth, const ls_options_t *opt, ls_entry_list_t *out) {
+    struct stat before, after;
+    if (stat(path, &before) != 0) return -1;
+    replay_t r = {opt, depth, {NULL, 0}, out, 0};
+    if (path_buf_init(&r.pb, path) != 0) {
+        errno = ENOMEM;
         return -1;
     }
-    for (size_t i = 0; i < tmp.last_entry_idx; ++i) {
-        ls_entry_t *e = &tmp.entries[i];
-        if (!should_include(opt, e->name, &e->st)) {
-            continue;
-        }
-        if (append_entry(out, e->name, e->full_path, &e->st) != 0) {
-            for (size_t j = 0; j < tmp.last_entry_idx; ++j) {
-                free(tmp.entries[j].name);
-                free(tmp.entries[j].full_path);
-            }
-            free(tmp.entries);
+    stats_add(STATS_SYS_STAT, 1);
+    if (ls_index_lookup(opt->index, &before, replay_entry, &r) == 0) {
+        stats_engine("index", "hit");
+    } else {
+        stats_engine("index", "miss");
+        ls_options_t full = *opt;
+        full.show_all_files = 1;
+        full.directory_only = 0;
+        full.long_format = 1;
+        full.want_blocks = 1;
+        full.filter = NULL;
+        full.index = NULL;
+        ls_entry_list_t raw;
+        list_init(&raw);
+        if (read_dir_batched(path, depth, &full, &raw, NULL, NULL) != 0) {
+            int saved = errno;
+            list_free(&raw);
+            free(r.pb.buf);
+            errno = saved;
             return -1;
         }
+        if (stat(path, &after) == 0) ls_index_store(opt->index, &before, &after, &raw);
+        for (size_t i = 0; i < raw.last_entry_idx; ++i) {
+            replay_entry(ls_entry_name(&raw, &raw.entries[i]), &raw.entries[i].st, &r);
+        }
+        list_free(&raw);
     }
-    for (size_t i = 0; i < tmp.last_entry_idx; ++i) {
-        free(tmp.entries[i].name);
-        free(tmp.entries[i].full_path);
+    free(r.pb.buf);
+    if (r.error) {
+        errno = ENOMEM;
+        return -1;
     }
-    free(tmp.entries);
     return 0;
 }
 
-static int collect_recursive(const char *path, const ls_options_t *opt, ls_entry_list_t *out) {
-    ls_entry_list_t cur;
-    list_init(&cur);
-    if (read_dir_raw(path, &cur) != 0) {
-        if (cur.entries) {
-            for (size_t i = 0; i < cur.last_entry_idx; ++i) {
-                free(cur.entries[i].name);
-                free(cur.entries[i].full_path);
+static int read_dir(const char *path, int depth, const ls_options_t *opt, ls_entry_list_t *out) {
+    if (opt->index) return read_dir_indexed(path, depth, opt, out);
+    return read_dir_batched(path, depth, opt, out, NULL, NULL);
+}
+
+#define LS_SORT_PARALLEL_MIN (256 * 1024)   // entries
+#define LS_SORT_RUN_MIN (64 * 1024)
+
+// Sort handle: a precomputed collation key and, for -t/-S, a fixed-width
+// key that orders ascending. Entries are permuted once at the end.
+typedef struct sort_item {
+    const char *key;    // the name itself under bytewise collation, else its strxfrm blob
+    uint64_t num;
+    size_t idx;
+} sort_item_t;
+
+typedef int (*sort_cmp_fn)(const void *, const void *);
+
+static int cmp_key(const void *a, const void *b) {
+    return strcmp(((const sort_item_t *)a)->key, ((const sort_item_t *)b)->key);
+}
+
+static int cmp_key_rev(const void *a, const void *b) {
+    return cmp_key(b, a);
+}
+
+static pthread_once_t locale_once = PTHREAD_ONCE_INIT;
+
+static void locale_init(void) {
+    setlocale(LC_ALL, "");
+}
+
+// Loading a locale costs a few opens and maps, which a listing that never
+// sorts or prints times can skip.
+void ls_use_locale(const ls_options_t *opt) {
+    if (opt->lazy_locale) pthread_once(&locale_once, locale_init);
+}
+
+static int collate_is_bytewise(void) {
+    const char *lc = setlocale(LC_COLLATE, NULL);
+    return !lc || strcmp(lc, "C") == 0 || strcmp(lc, "POSIX") == 0;
+}
+
+// strcmp on strxfrm output orders like strcoll on the names, so each name
+// is transformed once instead of in every comparison. All blobs share one
+// buffer, returned for the caller to free.
+static char *build_keys(const ls_entry_list_t *list, sort_item_t *items, size_t n) {
+    size_t *offs = (size_t *)malloc(n * sizeof(size_t));
+    size_t cap = list->pool_size * 2 + 256, used = 0;
+    char *blob = (char *)malloc(cap);
+    if (!offs || !blob) {
+        free(offs); free(blob);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        const char *name = ls_entry_name(list, &list->entries[i]);
+        for (;;) {
+            size_t len = strxfrm(blob + used, name, cap - used);
+            if (len < cap - used) {
+                offs[i] = used;
+                used += len + 1;
+                break;
             }
-            free(cur.entries);
+            size_t new_cap = cap * 2;
+            while (new_cap - used <= len) new_cap *= 2;
+            char *nb = (char *)realloc(blob, new_cap);
+            if (!nb) {
+                free(offs); free(blob);
+                return NULL;
+            }
+            blob = nb;
+            cap = new_cap;
         }
-        return -1;
     }
-    for (size_t i = 0; i < cur.last_entry_idx; ++i) {
-        ls_entry_t *e = &cur.entries[i];
-        if (should_include(opt, e->name, &e->st)) {
-            if (append_entry(out, e->name, e->full_path, &e->st) != 0) {
-                for (size_t j = 0; j < cur.last_entry_idx; ++j) {
-                    free(cur.entries[j].name);
-                    free(cur.entries[j].full_path);
-                }
-                free(cur.entries);
-                return -1;
-            }
+    for (size_t i = 0; i < n; ++i) items[i].key = blob + offs[i];
+    free(offs);
+    return blob;
+}
+
+typedef struct sort_run {
+    sort_item_t *base;
+    size_t n;
+    sort_cmp_fn cmp;
+} sort_run_t;
+
+static void *sort_run_thread(void *arg) {
+    sort_run_t *r = (sort_run_t *)arg;
+    qsort(r->base, r->n, sizeof(sort_item_t), r->cmp);
+    return NULL;
+}
+
+static void merge_runs(const sort_item_t *a, size_t na, const sort_item_t *b, size_t nb, sort_item_t *dst, sort_cmp_fn cmp) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) dst[k++] = cmp(&b[j], &a[i]) < 0 ? b[j++] : a[i++];
+    memcpy(dst + k, a + i, (na - i) * sizeof(sort_item_t));
+    memcpy(dst + k + na - i, b + j, (nb - j) * sizeof(sort_item_t));
+}
+
+// Large arrays are cut into one run per job, the runs are sorted on their
+// own threads and then merged pairwise.
+static void sort_items(sort_item_t *items, size_t n, sort_cmp_fn cmp, size_t jobs) {
+    size_t nruns = jobs;
+    if (nruns > n / LS_SORT_RUN_MIN) nruns = n / LS_SORT_RUN_MIN;
+    sort_item_t *tmp = NULL;
+    sort_run_t *runs = NULL;
+    pthread_t *ths = NULL;
+    size_t *bounds = NULL;
+    if (n >= LS_SORT_PARALLEL_MIN && nruns >= 2) {
+        tmp = (sort_item_t *)malloc(n * sizeof(sort_item_t));
+        runs = (sort_run_t *)malloc(nruns * sizeof(sort_run_t));
+        ths = (pthread_t *)malloc(nruns * sizeof(pthread_t));
+        bounds = (size_t *)malloc((nruns + 1) * sizeof(size_t));
+    }
+    if (!tmp || !runs || !ths || !bounds) {
+        free(tmp); free(runs); free(ths); free(bounds);
+        qsort(items, n, sizeof(sort_item_t), cmp);
+        return;
+    }
+    for (size_t r = 0; r <= nruns; ++r) bounds[r] = n * r / nruns;
+    size_t started = 0;
+    for (size_t r = 0; r < nruns; ++r) {
+        runs[r].base = items + bounds[r];
+        runs[r].n = bounds[r + 1] - bounds[r];
+        runs[r].cmp = cmp;
+        if (r > 0 && started == r - 1 && pthread_create(&ths[r], NULL, sort_run_thread, &runs[r]) == 0) {
+            started = r;
         }
-        if (S_ISDIR(e->st.st_mode)) {
-            if (is_dot_or_dotdot(e->name)) continue;
-            collect_recursive(e->full_path, opt, out);
+    }
+    sort_run_thread(&runs[0]);
+    for (size_t r = 1; r < nruns; ++r) {
+        if (r <= started) pthread_join(ths[r], NULL);
+        else sort_run_thread(&runs[r]);
+    }
+
+    sort_item_t *src = items, *dst = tmp;
+    while (nruns > 1) {
+        size_t out = 0;
+        for (size_t r = 0; r < nruns; r += 2) {
+            size_t lo = bounds[r];
+            if (r + 1 == nruns) {
+                memcpy(dst + lo, src + lo, (n - lo) * sizeof(sort_item_t));
+            } else {
+                size_t mid = bounds[r + 1], hi = bounds[r + 2];
+                merge_runs(src + lo, mid - lo, src + mid, hi - mid, dst + lo, cmp);
+            }
+            bounds[out++] = lo;
         }
+        bounds[out] = n;
+        nruns = out;
+        sort_item_t *t = src; src = dst; dst = t;
     }
-    for (size_t i = 0; i < cur.last_entry_idx; ++i) {
-        free(cur.entries[i].name);
-        free(cur.entries[i].full_path);
+    if (src != items) memcpy(items, src, n * sizeof(sort_item_t));
+    free(tmp); free(runs); free(ths); free(bounds);
+}
+
+// Stable LSD radix sort on num, a byte per pass; passes where every key
+// has the same byte are skipped, so small mtime/size ranges cost a few passes.
+static int radix_sort(sort_item_t *items, size_t n) {
+    sort_item_t *tmp = (sort_item_t *)malloc(n * sizeof(sort_item_t));
+    if (!tmp) return -1;
+    sort_item_t *src = items, *dst = tmp;
+    size_t count[256];
+    for (unsigned shift = 0; shift < 64; shift += 8) {
+        memset(count, 0, sizeof(count));
+        for (size_t i = 0; i < n; ++i) count[(src[i].num >> shift) & 0xff]++;
+        if (count[(src[0].num >> shift) & 0xff] == n) continue;
+        size_t sum = 0;
+        for (size_t b = 0; b < 256; ++b) {
+            size_t c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+        for (size_t i = 0; i < n; ++i) dst[count[(src[i].num >> shift) & 0xff]++] = src[i];
+        sort_item_t *t = src; src = dst; dst = t;
     }
-    free(cur.entries);
+    if (src != items) memcpy(items, src, n * sizeof(sort_item_t));
+    free(tmp);
     return 0;
 }
 
+// Maps a signed value to an unsigned key with the same ascending order.
+static inline uint64_t order_key(long long v) {
+    return (uint64_t)v ^ (1ull << 63);
+}
+
+// Names are sorted first (reversed for -r); -t/-S then run a stable radix
+// pass over the numeric key, so equal times or sizes stay in name order.
+static void sort_entries(ls_entry_list_t *list, const ls_options_t *opt) {
+    size_t n = list->last_entry_idx;
+    if (n <= 1 || opt->unsorted) return;
+    sort_item_t *items = (sort_item_t *)malloc(n * sizeof(sort_item_t));
+    ls_entry_t *sorted = (ls_entry_t *)malloc(n * sizeof(ls_entry_t));
+    if (!items || !sorted) {
+        free(items); free(sorted);
+        return;
+    }
+    char *blob = NULL;
+    ls_use_locale(opt);
+    if (!collate_is_bytewise()) blob = build_keys(list, items, n);
+    for (size_t i = 0; i < n; ++i) {
+        const ls_entry_t *e = &list->entries[i];
+        if (!blob) items[i].key = ls_entry_name(list, e);
+        items[i].idx = i;
+        items[i].num = 0;
+        if (opt->sort_key == LS_SORT_TIME) items[i].num = order_key((long long)e->st.st_mtime);
+        else if (opt->sort_key == LS_SORT_SIZE) items[i].num = order_key((long long)e->st.st_size);
+        // newest/largest first unless -r
+        if (!opt->reverse) items[i].num = ~items[i].num;
+    }
+    sort_items(items, n, opt->reverse ? cmp_key_rev : cmp_key, resolve_jobs(opt));
+    if (opt->sort_key != LS_SORT_NAME) radix_sort(items, n);
+    for (size_t i = 0; i < n; ++i) sorted[i] = list->entries[items[i].idx];
+    free(blob);
+    free(items);
+    free(list->entries);
+    list->entries = sorted;
+    list->capacity = n;
+}
+
 ls_ret_t ls(const char *path, const ls_options_t *options) {
     ls_ret_t ret;
     ret.error = 0;
@@ -212,41 +772,520 @@ ls_ret_t ls(const char *path, const ls_options_t *options) {
         return ret;
     }
 
+    stats_phase("read");
     if (S_ISDIR(st.st_mode)) {
-        if (options && options->recursive_listing) {
-            if (collect_recursive(path, options, &ret.entry_list) != 0) {
-                ret.error = 1;
-                return ret;
-            }
-        } else {
-            if (collect_filtered(path, options, &ret.entry_list) != 0) {
-                ret.error = 1;
-                return ret;
-            }
+        if (read_dir(path, 1, options, &ret.entry_list) != 0) {
+            ret.error = 1;
+            return ret;
         }
+        drop_unlisted(&ret.entry_list);
     } else {
-        if (should_include(options, path, &st)) {
-            if (append_entry(&ret.entry_list, path, path, &st) != 0) {
+        unsigned flags = 0;
+        if (include_name(options, path) && keep_entry(options, 1, path, &st, &flags) && !(flags & LS_ENTRY_UNLISTED)) {
+            if (append_entry(&ret.entry_list, "", 0, path, &st, 1) != 0) {
                 ret.error = 1;
                 return ret;
             }
         }
     }
 
+    stats_phase("sort");
     sort_entries(&ret.entry_list, options);
     return ret;
 }
 
+int ls_stream(const char *path, const ls_options_t *options, ls_batch_fn fn, void *ctx) {
+    struct stat st;
+    if (lstat(path, &st) != 0) return -1;
+    if (!S_ISDIR(st.st_mode)) {
+        ls_ret_t ret = ls(path, options);
+        if (ret.error) return -1;
+        if (ret.entry_list.last_entry_idx > 0) fn(path, &ret.entry_list, ctx);
+        ls_free_ret(&ret);
+        return 0;
+    }
+    ls_entry_list_t batch;
+    list_init(&batch);
+    int rc = read_dir_batched(path, 1, options, &batch, fn, ctx);
+    int saved = errno;
+    list_free(&batch);
+    errno = saved;
+    return rc;
+}
+
 void ls_free_ret(ls_ret_t *ret) {
     if (!ret) return;
-    if (ret->entry_list.entries) {
-        for (size_t i = 0; i < ret->entry_list.last_entry_idx; ++i) {
-            free(ret->entry_list.entries[i].name);
-            free(ret->entry_list.entries[i].full_path);
+    list_free(&ret->entry_list);
+}
+
+static inline int descends(const ls_entry_list_t *list, const ls_entry_t *e) {
+    return S_ISDIR(e->st.st_mode) && !(e->flags & LS_ENTRY_NO_DESCEND) && !is_dot_or_dotdot(ls_entry_name(list, e));
+}
+
+// With a filter, directories where nothing matched are left out of -R.
+static inline int skip_empty(const ls_options_t *opt, const ls_entry_list_t *entries) {
+    return opt->filter && entries && entries->last_entry_idx == 0;
+}
+
+#define LS_WALK_AHEAD 64    // read-ahead directories per worker
+
+// One directory of an ls_walk. Workers fill entries and children; the
+// emitting thread consumes nodes in pre-order and frees them.
+typedef struct walk_dir {
+    char *path;
+    int depth;          // of its entries; the root's are 1
+    ls_entry_list_t entries;
+    int error;
+    int done;
+    size_t nchildren;
+    struct walk_dir **children;
+} walk_dir_t;
+
+typedef struct walk_deque {
+    walk_dir_t **items;
+    size_t head;    // thieves take from here
+    size_t tail;    // the owner pushes and pops here
+    size_t cap;
+    pthread_mutex_t mu;
+} walk_deque_t;
+
+typedef struct walk_pool {
+    const ls_options_t *opt;
+    walk_deque_t *deques;
+    size_t nworkers;
+    size_t next_id;
+    size_t queued;      // nodes sitting in deques
+    size_t pending;     // queued plus nodes being read
+    size_t ready;       // nodes read but not yet emitted
+    size_t ahead;       // soft cap on ready
+    int emit_waiting;   // the emitter is blocked on an unread node
+    int aborted;        // the emitter ran out of memory; workers stop
+    walk_dir_t **stack; // the emitter's pre-order stack, freed by ls_walk
+    size_t stack_len, stack_cap;
+    pthread_mutex_t mu;
+    pthread_cond_t work_cv;
+    pthread_cond_t done_cv;
+} walk_pool_t;
+
+typedef struct walk_worker {
+    walk_pool_t *pool;
+    size_t id;
+} walk_worker_t;
+
+static walk_dir_t *walk_dir_new(const char *path, int depth) {
+    walk_dir_t *d = (walk_dir_t *)calloc(1, sizeof(walk_dir_t));
+    if (!d) return NULL;
+    d->depth = depth;
+    d->path = strdup(path);
+    if (!d->path) {
+        free(d);
+        return NULL;
+    }
+    list_init(&d->entries);
+    return d;
+}
+
+static void walk_dir_free(walk_dir_t *d) {
+    list_free(&d->entries);
+    free(d->children);
+    free(d->path);
+    free(d);
+}
+
+// A node and everything below it that was never emitted.
+static void walk_dir_free_tree(walk_dir_t *d) {
+    for (size_t i = 0; i < d->nchildren; ++i) walk_dir_free_tree(d->children[i]);
+    walk_dir_free(d);
+}
+
+static int deque_push(walk_deque_t *dq, walk_dir_t *d) {
+    pthread_mutex_lock(&dq->mu);
+    if (dq->tail == dq->cap) {
+        size_t live = dq->tail - dq->head;
+        if (dq->head > 0 && live < dq->cap / 2) {
+            memmove(dq->items, dq->items + dq->head, live * sizeof(walk_dir_t *));
+        } else {
+            size_t cap = dq->cap ? dq->cap * 2 : 64;
+            walk_dir_t **items = (walk_dir_t **)realloc(dq->items, cap * sizeof(walk_dir_t *));
+            if (!items) {
+                pthread_mutex_unlock(&dq->mu);
+                return -1;
+            }
+            memmove(items, items + dq->head, live * sizeof(walk_dir_t *));
+            dq->items = items;
+            dq->cap = cap;
         }
-        free(ret->entry_list.entries);
-        ret->entry_list.entries = NULL;
+        dq->head = 0;
+        dq->tail = live;
+    }
+    dq->items[dq->tail++] = d;
+    pthread_mutex_unlock(&dq->mu);
+    return 0;
+}
+
+static walk_dir_t *deque_pop(walk_deque_t *dq, int steal) {
+    walk_dir_t *d = NULL;
+    pthread_mutex_lock(&dq->mu);
+    if (dq->head < dq->tail) d = steal ? dq->items[dq->head++] : dq->items[--dq->tail];
+    if (dq->head == dq->tail) dq->head = dq->tail = 0;
+    pthread_mutex_unlock(&dq->mu);
+    return d;
+}
+
+// Own deque LIFO for locality, then steal the oldest (largest) work of others.
+static walk_dir_t *walk_take(walk_pool_t *pool, size_t id) {
+    walk_dir_t *d = deque_pop(&pool->deques[id], 0);
+    for (size_t k = 1; !d && k < pool->nworkers; ++k) {
+        d = deque_pop(&pool->deques[(id + k) % pool->nworkers], 1);
+    }
+    return d;
+}
+
+static void walk_read(walk_pool_t *pool, size_t id, walk_dir_t *d) {
+    const ls_options_t *opt = pool->opt;
+    if (read_dir(d->path, d->depth, opt, &d->entries) != 0) {
+        d->error = errno ? errno : EIO;
+        list_free(&d->entries);
+    } else {
+        sort_entries(&d->entries, opt);
+    }
+    size_t ndirs = 0;
+    for (size_t i = 0; i < d->entries.last_entry_idx; ++i) {
+        if (descends(&d->entries, &d->entries.entries[i])) ndirs++;
     }
-    ret->entry_list.last_entry_idx = 0;
-    ret->entry_list.capacity = 0;
+    if (ndirs > 0) d->children = (walk_dir_t **)malloc(ndirs * sizeof(walk_dir_t *));
+    if (d->children) {
+        for (size_t i = 0; i < d->entries.last_entry_idx; ++i) {
+            const ls_entry_t *e = &d->entries.entries[i];
+            if (!descends(&d->entries, e)) continue;
+            walk_dir_t *child = walk_dir_new(ls_entry_path(&d->entries, e), d->depth + 1);
+            if (!child) break;
+            d->children[d->nchildren++] = child;
+        }
+        // Count the children before publishing them, so a thief finishing
+        // one early can never drive pending to zero.
+        pthread_mutex_lock(&pool->mu);
+        pool->queued += d->nchildren;
+        pool->pending += d->nchildren;
+        pthread_mutex_unlock(&pool->mu);
+        // reversed so the owner pops the first child first
+        for (size_t i = d->nchildren; i-- > 0;) {
+            if (deque_push(&pool->deques[id], d->children[i]) != 0) {
+                pthread_mutex_lock(&pool->mu);
+                pool->queued--;
+                pool->pending--;
+                d->children[i]->error = ENOMEM;
+                d->children[i]->done = 1;
+                pool->ready++;
+                pthread_mutex_unlock(&pool->mu);
+            }
+        }
+    }
+    drop_unlisted(&d->entries);
+    pthread_mutex_lock(&pool->mu);
+    d->done = 1;
+    pool->ready++;
+    pool->pending--;
+    pthread_cond_broadcast(&pool->done_cv);
+    if (d->nchildren > 0 || pool->pending == 0) pthread_cond_broadcast(&pool->work_cv);
+    pthread_mutex_unlock(&pool->mu);
+}
+
+static void *walk_worker(void *argp) {
+    walk_worker_t *w = (walk_worker_t *)argp;
+    walk_pool_t *pool = w->pool;
+    for (;;) {
+        // Stay a bounded number of directories ahead of the emitter, unless
+        // it is blocked on one that is still queued.
+        pthread_mutex_lock(&pool->mu);
+        while (pool->pending > 0 && pool->ready >= pool->ahead && !pool->emit_waiting && !pool->aborted) {
+            pthread_cond_wait(&pool->work_cv, &pool->mu);
+        }
+        int aborted = pool->aborted;
+        pthread_mutex_unlock(&pool->mu);
+        if (aborted) break;
+        walk_dir_t *d = walk_take(pool, w->id);
+        if (!d) {
+            pthread_mutex_lock(&pool->mu);
+            while (pool->queued == 0 && pool->pending > 0 && !pool->aborted) pthread_cond_wait(&pool->work_cv, &pool->mu);
+            int finished = pool->pending == 0 || pool->aborted;
+            pthread_mutex_unlock(&pool->mu);
+            if (finished) break;
+            continue;
+        }
+        pthread_mutex_lock(&pool->mu);
+        pool->queued--;
+        pthread_mutex_unlock(&pool->mu);
+        walk_read(pool, w->id, d);
+    }
+    return NULL;
+}
+
+// Pre-order over the finished tree, waiting for nodes still being read.
+static void walk_emit(walk_pool_t *pool, ls_dir_fn fn, void *ctx) {
+    walk_dir_t **stack = pool->stack;
+    size_t cap = pool->stack_cap, len = pool->stack_len;
+    while (len > 0) {
+        walk_dir_t *d = stack[--len];
+        pthread_mutex_lock(&pool->mu);
+        if (!d->done) {
+            pool->emit_waiting = 1;
+            pthread_cond_broadcast(&pool->work_cv);
+            while (!d->done) pthread_cond_wait(&pool->done_cv, &pool->mu);
+            pool->emit_waiting = 0;
+        }
+        if (pool->ready-- == pool->ahead) pthread_cond_broadcast(&pool->work_cv);
+        pthread_mutex_unlock(&pool->mu);
+        if (!skip_empty(pool->opt, d->error ? NULL : &d->entries)) fn(d->path, d->error ? NULL : &d->entries, d->error, ctx);
+        if (len + d->nchildren > cap) {
+            while (len + d->nchildren > cap) cap *= 2;
+            walk_dir_t **ns = (walk_dir_t **)realloc(stack, cap * sizeof(walk_dir_t *));
+            if (!ns) {
+                // Workers may be parked on the read-ahead cap, which only
+                // emitting lifts: stop them, and leave d's subtree to ls_walk.
+                stack[len++] = d;
+                pthread_mutex_lock(&pool->mu);
+                pool->aborted = 1;
+                pthread_cond_broadcast(&pool->work_cv);
+                pthread_mutex_unlock(&pool->mu);
+                break;
+            }
+            stack = ns;
+            pool->stack_cap = cap;
+        }
+        for (size_t i = d->nchildren; i-- > 0;) stack[len++] = d->children[i];
+        walk_dir_free(d);
+    }
+    pool->stack = stack;
+    pool->stack_len = len;
+}
+
+// Single-job walk: each directory is read, sorted, emitted and released
+// before its children are visited. Only the subdirectory paths of every
+// ancestor stay alive, so memory follows the largest directory and the depth.
+static void walk_serial(const char *path, int depth, const ls_options_t *opt, ls_entry_list_t *list, ls_dir_fn fn, void *ctx) {
+    list_clear(list);
+    if (read_dir(path, depth, opt, list) != 0) {
+        fn(path, NULL, errno ? errno : EIO, ctx);
+        return;
+    }
+    sort_entries(list, opt);
+
+    // child paths, NUL-separated, in listing order
+    size_t len = 0, nchildren = 0;
+    for (size_t i = 0; i < list->last_entry_idx; ++i) {
+        const ls_entry_t *e = &list->entries[i];
+        if (!descends(list, e)) continue;
+        len += e->full_path_size + 1;
+        nchildren++;
+    }
+    char *children = nchildren ? (char *)malloc(len) : NULL;
+    char *p = children;
+    for (size_t i = 0; children && i < list->last_entry_idx; ++i) {
+        const ls_entry_t *e = &list->entries[i];
+        if (!descends(list, e)) continue;
+        memcpy(p, ls_entry_path(list, e), e->full_path_size + 1);
+        p += e->full_path_size + 1;
+    }
+    drop_unlisted(list);
+    if (!skip_empty(opt, list)) fn(path, list, 0, ctx);
+    if (!children) return;
+    for (p = children; nchildren-- > 0; p += strlen(p) + 1) walk_serial(p, depth + 1, opt, list, fn, ctx);
+    free(children);
+}
+
+int ls_walk(const char *path, const ls_options_t *options, ls_dir_fn fn, void *ctx) {
+    struct stat st;
+    if (lstat(path, &st) != 0) return -1;
+    if (!S_ISDIR(st.st_mode)) {
+        ls_ret_t ret = ls(path, options);
+        if (ret.error) return -1;
+        fn(path, &ret.entry_list, 0, ctx);
+        ls_free_ret(&ret);
+        return 0;
+    }
+
+    size_t nworkers = resolve_jobs(options);
+    if (nworkers == 1) {
+        ls_entry_list_t list;
+        list_init(&list);
+        walk_serial(path, 1, options, &list, fn, ctx);
+        list_free(&list);
+        return 0;
+    }
+    // setlocale is not thread-safe, so a lazy locale is loaded here rather
+    // than by the first worker that sorts.
+    ls_use_locale(options);
+    walk_pool_t pool;
+    memset(&pool, 0, sizeof(pool));
+    pool.opt = options;
+    pool.nworkers = nworkers;
+    pool.deques = (walk_deque_t *)calloc(nworkers, sizeof(walk_deque_t));
+    pthread_t *ths = (pthread_t *)malloc(nworkers * sizeof(pthread_t));
+    walk_worker_t *ws = (walk_worker_t *)malloc(nworkers * sizeof(walk_worker_t));
+    pool.stack_cap = 64;
+    pool.stack = (walk_dir_t **)malloc(pool.stack_cap * sizeof(walk_dir_t *));
+    walk_dir_t *root = walk_dir_new(path, 1);
+    if (!pool.deques || !ths || !ws || !pool.stack || !root || deque_push(&pool.deques[0], root) != 0) {
+        if (root) walk_dir_free(root);
+        free(pool.deques); free(ths); free(ws); free(pool.stack);
+        errno = ENOMEM;
+        return -1;
+    }
+    pool.stack[pool.stack_len++] = root;
+    for (size_t i = 0; i < nworkers; ++i) pthread_mutex_init(&pool.deques[i].mu, NULL);
+    pthread_mutex_init(&pool.mu, NULL);
+    pthread_cond_init(&pool.work_cv, NULL);
+    pthread_cond_init(&pool.done_cv, NULL);
+    pool.queued = 1;
+    pool.pending = 1;
+    pool.ahead = nworkers * LS_WALK_AHEAD;
+
+    size_t started = 0;
+    for (; started < nworkers; ++started) {
+        ws[started].pool = &pool;
+        ws[started].id = started;
+        if (pthread_create(&ths[started], NULL, walk_worker, &ws[started]) != 0) break;
+    }
+    if (started == 0) {
+        // no threads: read everything here, then emit
+        ws[0].pool = &pool;
+        ws[0].id = 0;
+        walk_worker(&ws[0]);
+    }
+    walk_emit(&pool, fn, ctx);
+    for (size_t i = 0; i < started; ++i) pthread_join(ths[i], NULL);
+    // Left over only if emitting was aborted; the workers are gone now.
+    for (size_t i = 0; i < pool.stack_len; ++i) walk_dir_free_tree(pool.stack[i]);
+    free(pool.stack);
+
+    pthread_cond_destroy(&pool.done_cv);
+    pthread_cond_destroy(&pool.work_cv);
+    pthread_mutex_destroy(&pool.mu);
+    for (size_t i = 0; i < nworkers; ++i) {
+        pthread_mutex_destroy(&pool.deques[i].mu);
+        free(pool.deques[i].items);
+    }
+    free(pool.deques); free(ths); free(ws);
+    if (pool.aborted) {
+        errno = ENOMEM;
+        return -1;
+    }
+    return 0;
+}
+
+// Process-wide uid/gid -> name cache. Ids with no entry are cached too, so
+// every distinct owner costs at most one NSS round trip per run.
+typedef struct id_slot {
+    unsigned id;
+    int used;
+    char *name;     // NULL: id has no entry
+} id_slot_t;
+
+typedef struct id_cache {
+    id_slot_t *slots;
+    size_t cap;     // power of two
+    size_t count;
+} id_cache_t;
+
+static id_cache_t user_cache, group_cache;
+static pthread_mutex_t id_cache_mu = PTHREAD_MUTEX_INITIALIZER;
+
+static inline size_t id_hash(unsigned id) {
+    uint32_t h = id * 0x9e3779b1u;
+    return (size_t)(h ^ (h >> 16));
+}
+
+static id_slot_t *id_find(id_cache_t *c, unsigned id) {
+    if (!c->slots) return NULL;
+    size_t mask = c->cap - 1;
+    for (size_t i = id_hash(id) & mask;; i = (i + 1) & mask) {
+        if (!c->slots[i].used) return &c->slots[i];
+        if (c->slots[i].id == id) return &c->slots[i];
+    }
+}
+
+static int id_grow(id_cache_t *c) {
+    size_t cap = c->cap ? c->cap * 2 : 64;
+    id_slot_t *slots = (id_slot_t *)calloc(cap, sizeof(id_slot_t));
+    if (!slots) return -1;
+    for (size_t i = 0; i < c->cap; ++i) {
+        if (!c->slots[i].used) continue;
+        size_t j = id_hash(c->slots[i].id) & (cap - 1);
+        while (slots[j].used) j = (j + 1) & (cap - 1);
+        slots[j] = c->slots[i];
+    }
+    free(c->slots);
+    c->slots = slots;
+    c->cap = cap;
+    return 0;
+}
+
+// Returns 0 with *name set, or NULL when the id has no entry; -1 when the
+// lookup itself failed (ENOMEM, an unreachable NSS backend), which says
+// nothing about the id and must not be cached.
+static int resolve_id(unsigned id, int group, char **name) {
+    long sz = sysconf(group ? _SC_GETGR_R_SIZE_MAX : _SC_GETPW_R_SIZE_MAX);
+    size_t len = sz > 0 ? (size_t)sz : 1024;
+    *name = NULL;
+    for (;;) {
+        char *buf = (char *)malloc(len);
+        if (!buf) return -1;
+        int err;
+        const char *found = NULL;
+        if (group) {
+            struct group gr, *res = NULL;
+            err = getgrgid_r((gid_t)id, &gr, buf, len, &res);
+            if (err == 0 && res) found = res->gr_name;
+        } else {
+            struct passwd pw, *res = NULL;
+            err = getpwuid_r((uid_t)id, &pw, buf, len, &res);
+            if (err == 0 && res) found = res->pw_name;
+        }
+        if (found) *name = strdup(found);
+        free(buf);
+        if (err == 0) return found && !*name ? -1 : 0;
+        if (err != ERANGE || len > (1u << 20)) return -1;
+        len *= 2;
+    }
+}
+
+static const char *id_name(id_cache_t *c, unsigned id, int group) {
+    pthread_mutex_lock(&id_cache_mu);
+    id_slot_t *s = id_find(c, id);
+    if (s && s->used) {
+        const char *name = s->name;
+        pthread_mutex_unlock(&id_cache_mu);
+        return name;
+    }
+    // resolve unlocked: NSS may be slow, and a duplicate lookup is harmless
+    pthread_mutex_unlock(&id_cache_mu);
+    char *name;
+    if (resolve_id(id, group, &name) != 0) return NULL;
+    pthread_mutex_lock(&id_cache_mu);
+    if ((c->count + 1) * 2 > c->cap && id_grow(c) != 0) {
+        pthread_mutex_unlock(&id_cache_mu);
+        free(name);
+        return NULL;
+    }
+    s = id_find(c, id);
+    if (s->used) {
+        free(name); // another thread got there first
+    } else {
+        s->used = 1;
+        s->id = id;
+        s->name = name;
+        c->count++;
+    }
+    name = s->name;
+    pthread_mutex_unlock(&id_cache_mu);
+    return name;
+}
+
+const char *ls_user_name(uid_t uid) {
+    return id_name(&user_cache, (unsigned)uid, 0);
+}
+
+const char *ls_group_name(gid_t gid) {
+    return id_name(&group_cache, (unsigned)gid, 1);
 }
@@ -2,6 +2,7 @@
 #define LS_H
 #include <stddef.h>
 #include <sys/stat.h>
+#include <sys/types.h>
 
 typedef enum {
     LS_SORT_NAME = 0,
@@ -9,6 +10,9 @@ typedef enum {
     LS_SORT_SIZE
 } ls_sort_key_t;
 
+struct ls_filter;
+struct ls_index;
+
 typedef struct _ls_options {
     int show_all_files;     // -a
     int recursive_listing;  // -R
@@ -18,28 +22,80 @@ typedef struct _ls_options {
     int reverse;            // -r
     ls_sort_key_t sort_key; //  LS_SORT_NAME
     int directory_only;     // -d
+    int numeric_ids;        // -n
+    int unsorted;           // -U, -f: directory order
+    int jobs;               // -j, directories read in parallel by ls_walk, 0 = one per CPU
+    const struct ls_filter *filter; // -e, NULL lists everything
+    int want_blocks;        // fill st_blocks and st_nlink (du)
+    struct ls_index *index; // -I, NULL reads every directory
+    int lazy_locale;        // setlocale(LC_ALL, "") on the first name sort or time column
 } ls_options_t;
 
 typedef struct _ls_entry {
-    char *name;
-    size_t name_size;       
-    char *full_path;
-    size_t full_path_size;  
-    struct stat st;         
+    size_t name_off;        // offsets into the owning list's pool;
+    size_t name_size;       // the name is the tail of the full path
+    size_t full_path_off;
+    size_t full_path_size;
+    struct stat st;
+    int stat_valid;         // 0: only the S_IFMT bits of st.st_mode are set (from d_type)
+    unsigned flags;         // LS_ENTRY_*
 } ls_entry_t;
 
+#define LS_ENTRY_UNLISTED 1u    // failed the filter; internal, never handed out
+#define LS_ENTRY_NO_DESCEND 2u  // -prune or -maxdepth: -R does not enter it
+
 typedef struct _ls_entry_list {
     ls_entry_t *entries;
     size_t last_entry_idx;
     size_t capacity;
+    char *pool;             // arena holding every path, released in one free
+    size_t pool_size;
+    size_t pool_cap;
 } ls_entry_list_t;
 
+static inline const char *ls_entry_name(const ls_entry_list_t *list, const ls_entry_t *e) {
+    return list->pool + e->name_off;
+}
+
+static inline const char *ls_entry_path(const ls_entry_list_t *list, const ls_entry_t *e) {
+    return list->pool + e->full_path_off;
+}
+
 typedef struct _ls_ret {
     ls_entry_list_t entry_list;
     int error;
 } ls_ret_t;
 
+// Lists one directory, or a single non-directory path; recursive listings
+// go through ls_walk.
 ls_ret_t ls(const char *path, const ls_options_t *options);
 void ls_free_ret(ls_ret_t *ret);
+// Loads the environment's locale once if options defer it. setlocale races
+// with threads using the locale, so the first call must come before any
+// are started; ls_walk makes it before starting its pool.
+void ls_use_locale(const ls_options_t *options);
+
+// Streaming listing for unsorted output: fn receives the entries of path
+// one read batch at a time, and the list is reused after fn returns, so
+// memory stays bounded by a single batch however large the directory is.
+typedef void (*ls_batch_fn)(const char *path, const ls_entry_list_t *batch, void *ctx);
+int ls_stream(const char *path, const ls_options_t *options, ls_batch_fn fn, void *ctx);
+
+// Called once per directory with its filtered, sorted entries (NULL and an
+// errno if it could not be read), in the order of a depth-first walk.
+typedef void (*ls_dir_fn)(const char *dir_path, const ls_entry_list_t *entries, int error, void *ctx);
+
+// Recursive listing, handed to fn in deterministic pre-order. With one job
+// each directory is released before its children are read; otherwise a
+// pool of work-stealing workers reads a bounded distance ahead of fn.
+int ls_walk(const char *path, const ls_options_t *options, ls_dir_fn fn, void *ctx);
+
+// Owner names from a process-wide cache; each id is resolved once, and
+// NULL (no such user/group) is cached as well. Safe from any thread.
+const char *ls_user_name(uid_t uid);
+const char *ls_group_name(gid_t gid);
+
+// Command-line entry point; main() calls it unless built with UNIXC_MULTICALL.
+int ls_main(int argc, char **argv);
 
 #endif
\ No newline at end of file
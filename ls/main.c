@@ -1,155 +1,174 @@
 #include "ls.h"
+#include "filter.h"
+#include "format.h"
+#include "index.h"
+#include "../common/stats.h"
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
-#include <pwd.h>
-#include <grp.h>
-#include <time.h>
 #include <sys/stat.h>
-#include <limits.h>
 
-static void format_mode(mode_t m, char out[11]) {
-    out[0] = S_ISDIR(m) ? 'd' : S_ISLNK(m) ? 'l' : S_ISCHR(m) ? 'c' : S_ISBLK(m) ? 'b' : S_ISFIFO(m) ? 'p' : S_ISSOCK(m) ? 's' : '-';
-    out[1] = (m & S_IRUSR) ? 'r' : '-';
-    out[2] = (m & S_IWUSR) ? 'w' : '-';
-    out[3] = (m & S_IXUSR) ? ((m & S_ISUID) ? 's' : 'x') : ((m & S_ISUID) ? 'S' : '-');
-    out[4] = (m & S_IRGRP) ? 'r' : '-';
-    out[5] = (m & S_IWGRP) ? 'w' : '-';
-    out[6] = (m & S_IXGRP) ? ((m & S_ISGID) ? 's' : 'x') : ((m & S_ISGID) ? 'S' : '-');
-    out[7] = (m & S_IROTH) ? 'r' : '-';
-    out[8] = (m & S_IWOTH) ? 'w' : '-';
-    out[9] = (m & S_IXOTH) ? ((m & S_ISVTX) ? 't' : 'x') : ((m & S_ISVTX) ? 'T' : '-');
-    out[10] = '\0';
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [-alhnRrFtSdUf] [-j jobs] [-e expr] [-I indexfile] [path ...]\n", prog);
 }
 
-static void human_size(off_t s, char *buf, size_t n) {
-    const char *units[] = {"B","K","M","G","T","P"};
-    double v = (double)s;
-    int idx = 0;
-    while (v >= 1024.0 && idx < 5) { v /= 1024.0; idx++; }
-    if (idx == 0) snprintf(buf, n, "%lld", (long long)s);
-    else snprintf(buf, n, "%.1f%s", v, units[idx]);
-}
+static ls_out_t out;
+static ls_filter_t *filter;
+static ls_index_t *dir_index;
 
-static char type_suffix(const struct stat *st) {
-    if (S_ISDIR(st->st_mode)) return '/';
-    if (S_ISLNK(st->st_mode)) return '@';
-    if ((st->st_mode & (S_IXUSR|S_IXGRP|S_IXOTH)) != 0) return '*';
-    return '\0';
+static void print_header(const char *path) {
+    ls_out_str(&out, path);
+    ls_out_write(&out, ":\n", 2);
 }
 
-static void print_entry(const ls_entry_t *e, const ls_options_t *opt) {
-    char suffix = '\0';
-    if (opt->show_file_type) suffix = type_suffix(&e->st);
-
-    if (opt->long_format) {
-        char modebuf[11];
-        format_mode(e->st.st_mode, modebuf);
-
-        struct passwd *pw = getpwuid(e->st.st_uid);
-        struct group  *gr = getgrgid(e->st.st_gid);
-        const char *user = pw ? pw->pw_name : "?";
-        const char *group = gr ? gr->gr_name : "?";
-
-        char sizebuf[32];
-        if (opt->human_readable) human_size(e->st.st_size, sizebuf, sizeof(sizebuf));
-        else snprintf(sizebuf, sizeof(sizebuf), "%lld", (long long)e->st.st_size);
+static void print_dir(const char *dir_path, const ls_entry_list_t *entries, int error, void *ctx) {
+    const ls_options_t *opt = (const ls_options_t *)ctx;
+    if (!entries) {
+        ls_out_flush(&out);
+        fprintf(stderr, "ls: cannot open directory '%s': %s\n", dir_path, strerror(error));
+        return;
+    }
+    print_header(dir_path);
+    ls_format_list(&out, entries, opt);
+    ls_out_write(&out, "\n", 1);
+}
 
-        char timebuf[64];
-        struct tm lt;
-        localtime_r(&e->st.st_mtime, &lt);
-        strftime(timebuf, sizeof(timebuf), "%b %e %H:%M", &lt);
+static void print_batch(const char *path, const ls_entry_list_t *batch, void *ctx) {
+    (void)path;
+    ls_format_list(&out, batch, (const ls_options_t *)ctx);
+}
 
-        if (S_ISLNK(e->st.st_mode)) {
-            char linkbuf[PATH_MAX];
-            ssize_t n = readlink(e->full_path, linkbuf, sizeof(linkbuf)-1);
-            if (n >= 0) linkbuf[n] = '\0'; else linkbuf[0] = '\0';
-            printf("%s %3lld %-8s %-8s %8s %s %s%s -> %s\n",
-                modebuf,
-                (long long)e->st.st_nlink,
-                user,
-                group,
-                sizebuf,
-                timebuf,
-                e->name,
-                suffix ? (char[2]){suffix,'\0'} : "",
-                linkbuf);
-        } else {
-            printf("%s %3lld %-8s %-8s %8s %s %s%s\n",
-                modebuf,
-                (long long)e->st.st_nlink,
-                user,
-                group,
-                sizebuf,
-                timebuf,
-                e->name,
-                suffix ? (char[2]){suffix,'\0'} : "");
-        }
-    } else {
-        if (suffix) printf("%s%c\n", e->name, suffix);
-        else printf("%s\n", e->name);
+// Lists one path, under a "path:" header when several were given. Unsorted
+// listings stream straight from the directory reader.
+static int list_path(const char *path, const ls_options_t *opt, int header) {
+    if (opt->unsorted) {
+        struct stat st;
+        if (lstat(path, &st) != 0) return -1;
+        if (header) print_header(path);
+        return ls_stream(path, opt, print_batch, (void *)opt);
     }
+    ls_ret_t ret = ls(path, opt);
+    if (ret.error) return -1;
+    if (header) print_header(path);
+    stats_phase("format");
+    ls_format_list(&out, &ret.entry_list, opt);
+    ls_free_ret(&ret);
+    return 0;
 }
 
-static void print_usage(const char *prog) {
-    fprintf(stderr, "Usage: %s [-alhRrFtSd] [path ...]\n", prog);
+// Frees the filter and index, which outlive one call under unixcd; every
+// return from ls_main goes through here.
+static int release(int exit_code) {
+    ls_filter_free(filter);
+    filter = NULL;
+    if (ls_index_close(dir_index) != 0) exit_code = 1;
+    dir_index = NULL;
+    return exit_code;
 }
 
-int main(int argc, char **argv) {
+// Flushes pending output; a failed write turns into exit status 1.
+static int finish(int exit_code) {
+    exit_code = release(exit_code);
+    if (ls_out_flush(&out) != 0) {
+        fprintf(stderr, "ls: write error: %s\n", strerror(out.error));
+        return 1;
+    }
+    return exit_code;
+}
+
+int ls_main(int argc, char **argv) {
+    stats_init("ls", &argc, argv);
     ls_options_t opt = {0};
     opt.sort_key = LS_SORT_NAME;
+    opt.lazy_locale = 1;
     int c;
-    while ((c = getopt(argc, argv, "alhRrFtSd")) != -1) {
+    while ((c = getopt(argc, argv, "alhnRrFtSdUfj:e:I:")) != -1) {
         switch (c) {
             case 'a': opt.show_all_files = 1; break;
             case 'l': opt.long_format = 1; break;
             case 'h': opt.human_readable = 1; break;
+            case 'n': opt.numeric_ids = 1; opt.long_format = 1; break;
             case 'R': opt.recursive_listing = 1; break;
             case 'r': opt.reverse = 1; break;
             case 'F': opt.show_file_type = 1; break;
             case 't': opt.sort_key = LS_SORT_TIME; break;
             case 'S': opt.sort_key = LS_SORT_SIZE; break;
             case 'd': opt.directory_only = 1; break;
+            case 'U': opt.unsorted = 1; break;
+            case 'f': opt.unsorted = 1; opt.show_all_files = 1; break;
+            case 'j': opt.jobs = atoi(optarg); break;
+            case 'e':
+                ls_filter_free(filter);
+                filter = ls_filter_compile(optarg);
+                if (!filter) return release(1);
+                opt.filter = filter;
+                break;
+            case 'I':
+                ls_index_close(dir_index);
+                dir_index = ls_index_open(optarg);
+                if (!dir_index) {
+                    perror("ls: index");
+                    return release(1);
+                }
+                opt.index = dir_index;
+                break;
             default:
                 print_usage(argv[0]);
-                return 1;
+                return release(1);
         }
     }
 
+    // -e matches with fnmatch, which follows LC_CTYPE
+    if (opt.filter) ls_use_locale(&opt);
+    ls_out_init(&out, STDOUT_FILENO);
+    if (opt.recursive_listing) stats_phase("walk");
     int npaths = argc - optind;
+    if (opt.recursive_listing) {
+        int exit_code = 0;
+        if (npaths == 0) {
+            if (ls_walk(".", &opt, print_dir, &opt) != 0) {
+                perror("ls");
+                return finish(1);
+            }
+            return finish(0);
+        }
+        for (int i = optind; i < argc; ++i) {
+            if (ls_walk(argv[i], &opt, print_dir, &opt) != 0) {
+                int err = errno;
+                ls_out_flush(&out);
+                fprintf(stderr, "ls: cannot access '%s': %s\n", argv[i], strerror(err));
+                exit_code = 1;
+            }
+        }
+        return finish(exit_code);
+    }
     if (npaths == 0) {
-        const char *path = ".";
-        ls_ret_t ret = ls(path, &opt);
-        if (ret.error) {
+        if (list_path(".", &opt, 0) != 0) {
+            ls_out_flush(&out);
             perror("ls");
-            return 1;
+            return finish(1);
         }
-        for (size_t i = 0; i < ret.entry_list.last_entry_idx; ++i) {
-            print_entry(&ret.entry_list.entries[i], &opt);
-        }
-        ls_free_ret(&ret);
-        return 0;
+        return finish(0);
     }
 
     int exit_code = 0;
     for (int i = optind; i < argc; ++i) {
         const char *path = argv[i];
-        ls_ret_t ret = ls(path, &opt);
-        if (ret.error) {
+        if (list_path(path, &opt, npaths > 1) != 0) {
+            ls_out_flush(&out);
             fprintf(stderr, "ls: cannot access '%s'\n", path);
             exit_code = 1;
             continue;
         }
-        if (npaths > 1 || opt.recursive_listing) {
-            printf("%s:\n", path);
-        }
-        for (size_t j = 0; j < ret.entry_list.last_entry_idx; ++j) {
-            print_entry(&ret.entry_list.entries[j], &opt);
-        }
-        if (npaths > 1 || opt.recursive_listing) putchar('\n');
-        ls_free_ret(&ret);
+        if (npaths > 1) ls_out_write(&out, "\n", 1);
     }
-    return exit_code;
+    return finish(exit_code);
 }
 
+#ifndef UNIXC_MULTICALL
+int main(int argc, char **argv) {
+    return ls_main(argc, argv);
+}
+#endif
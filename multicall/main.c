@@ -0,0 +1,23 @@
+#include "tools.h"
+#include <stdio.h>
+#include <string.h>
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s TOOL [args ...], or run it through a link named TOOL\n", prog);
+    fprintf(stderr, "  tools: ");
+    unixc_tool_list(stderr);
+}
+
+// Dispatches on the name it was run as (a symlink or hard link per tool),
+// or on the first argument when run under its own name.
+int main(int argc, char **argv) {
+    const char *base = argc > 0 ? strrchr(argv[0], '/') : NULL;
+    base = base ? base + 1 : argc > 0 ? argv[0] : "unixc";
+    const unixc_tool_t *t = unixc_tool_find(base);
+    if (t) return t->main(argc, argv);
+    if (argc < 2 || !(t = unixc_tool_find(argv[1]))) {
+        print_usage(base);
+        return 1;
+    }
+    return t->main(argc - 1, argv + 1);
+}
@@ -0,0 +1,31 @@
+#include "tools.h"
+#include "../cat/cat.h"
+#include "../cksum/cksum.h"
+#include "../cp/cp.h"
+#include "../du/du.h"
+#include "../ls/ls.h"
+#include "../wc/wc.h"
+#include <string.h>
+
+static const unixc_tool_t tools[] = {
+    { "cat", cat_main },
+    { "cksum", cksum_main },
+    { "cp", cp_main },
+    { "du", du_main },
+    { "ls", ls_main },
+    { "wc", wc_main },
+};
+
+const unixc_tool_t *unixc_tool_find(const char *name) {
+    for (size_t i = 0; i < sizeof(tools) / sizeof(tools[0]); ++i) {
+        if (strcmp(tools[i].name, name) == 0) return &tools[i];
+    }
+    return NULL;
+}
+
+void unixc_tool_list(FILE *f) {
+    for (size_t i = 0; i < sizeof(tools) / sizeof(tools[0]); ++i) {
+        fprintf(f, "%s%s", i ? " " : "", tools[i].name);
+    }
+    fputc('\n', f);
+}
@@ -0,0 +1,15 @@
+#ifndef MULTICALL_TOOLS_H
+#define MULTICALL_TOOLS_H
+#include <stdio.h>
+
+typedef struct unixc_tool {
+    const char *name;
+    int (*main)(int argc, char **argv);
+} unixc_tool_t;
+
+// NULL if no tool has that name.
+const unixc_tool_t *unixc_tool_find(const char *name);
+// Writes the tool names on one line, space separated.
+void unixc_tool_list(FILE *f);
+
+#endif
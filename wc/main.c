@@ -6,6 +6,7 @@
 #include <unistd.h>
 #include <ctype.h>
 #include "wc.h"
+#include "../common/stats.h"
 
 static void print_usage(const char *prog) {
     fprintf(stderr, "Usage: %s [-lwc] [file ...]\\n", prog);
@@ -25,7 +26,8 @@ static void print_selected(const wc_result_t *r, int show_l, int show_w, int sho
     putchar('\n');
 }
 
-int main(int argc,char **argv){
+int wc_main(int argc,char **argv){
+    stats_init("wc", &argc, argv);
     int show_l = 0, show_w = 0, show_c = 0;
     int opt;
     while ((opt = getopt(argc, argv, "lwc")) != -1) {
@@ -93,3 +95,9 @@ int main(int argc,char **argv){
     }
     return exit_code;
 }
+
+#ifndef UNIXC_MULTICALL
+int main(int argc, char **argv) {
+    return wc_main(argc, argv);
+}
+#endif
@@ -1,4 +1,7 @@
 #include "wc.h"
+#include "../common/input.h"
+#include "../common/stats.h"
+#include <errno.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
@@ -6,7 +9,6 @@
 #include <stdbool.h>
 #include <string.h>
 #include <pthread.h>
-#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -23,6 +25,7 @@ typedef struct chunk_args {
     size_t begin;
     size_t end; // exclusive
     chunk_result_t *out;
+    int timed;  // one of several threads, reported to --stats
 } chunk_args_t;
 
 static inline int is_space_uc(unsigned char c) {
@@ -38,6 +41,7 @@ static void *count_chunk(void *argp) {
     if (p >= q) {
         return NULL;
     }
+    double t0 = arg->timed ? stats_now() : 0;
     res->bytes = (size_t)(q - p);
     res->head_word_char = !is_space_uc(*p);
     res->tail_word_char = !is_space_uc(*(q - 1));
@@ -51,129 +55,111 @@ static void *count_chunk(void *argp) {
             if (!in_word) { res->words++; in_word = true; }
         }
     }
+    if (arg->timed && stats_enabled) stats_chunk("wc", stats_now() - t0, res->bytes);
     return NULL;
 }
 
-static wc_result_t *do_wc_mmap_mt(int fd) {
-    struct stat st;
-    if (fstat(fd, &st) != 0) {
-        perror("wc: fstat");
-        return NULL;
-    }
-    if (!S_ISREG(st.st_mode)) {
-        return NULL; 
-    }
-    size_t size = (size_t)st.st_size;
-    if (size == 0) {
-        wc_result_t *r = (wc_result_t *)malloc(sizeof(wc_result_t));
-        if (!r) { perror("wc: malloc"); return NULL; }
-        r->byte_cnt = 0; r->word_cnt = 0; r->line_cnt = 0;
-        return r;
-    }
-    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
-    if (map == MAP_FAILED) {
-        perror("wc: mmap");
-        return NULL;
+#define WC_MIN_CHUNK (256 * 1024)
+#define WC_PARALLEL_MIN (4u << 20)  // smaller blocks are counted on the calling thread
+
+// Looked up on the first block big enough to split, so small inputs never
+// pay for the /sys read behind sysconf.
+static size_t online_cpus(void) {
+    static size_t cached;
+    size_t cpus = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+    if (cpus == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        cpus = n < 1 ? 1 : (size_t)n;
+        __atomic_store_n(&cached, cpus, __ATOMIC_RELAXED);
     }
-    close(fd);
+    return cpus;
+}
 
-    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
-    if (cpus < 1) cpus = 1;
-    const size_t MIN_CHUNK = 256 * 1024; 
-    size_t max_threads_by_size = (size + MIN_CHUNK - 1) / MIN_CHUNK;
-    size_t nthreads = (size_t)cpus;
+// Counts one block, split across threads when it is a large mmap window,
+// and joins a word that straddles the previous block. cpus 0 means all
+// online CPUs.
+static void count_block(wc_state_t *st, const unsigned char *data, size_t size, size_t cpus) {
+    if (size == 0) return;
+    size_t max_threads_by_size = (size + WC_MIN_CHUNK - 1) / WC_MIN_CHUNK;
+    size_t nthreads = 1;
+    if (size >= WC_PARALLEL_MIN) nthreads = cpus ? cpus : online_cpus();
     if (nthreads > max_threads_by_size) nthreads = max_threads_by_size;
     if (nthreads < 1) nthreads = 1;
 
-    pthread_t *ths = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
-    chunk_args_t *args = (chunk_args_t *)malloc(nthreads * sizeof(chunk_args_t));
-    chunk_result_t *res = (chunk_result_t *)malloc(nthreads * sizeof(chunk_result_t));
-    if (!ths || !args || !res) {
-        perror("wc: malloc threads");
-        munmap(map, size);
-        free(ths); free(args); free(res);
-        return NULL;
-    }
-
-    size_t base = 0;
-    size_t chunk = size / nthreads;
-    size_t rem = size % nthreads;
-    for (size_t i = 0; i < nthreads; ++i) {
-        size_t begin = base;
-        size_t len = chunk + (i < rem ? 1 : 0);
-        size_t end = begin + len;
-        args[i].data = (const unsigned char *)map;
-        args[i].begin = begin;
-        args[i].end = end;
-        args[i].out = &res[i];
-        base = end;
-        if (pthread_create(&ths[i], NULL, count_chunk, &args[i]) != 0) {
-            perror("wc: pthread_create");
-            for (size_t j = 0; j < i; ++j) pthread_join(ths[j], NULL);
-            chunk_args_t one = { .data = (const unsigned char *)map, .begin = 0, .end = size, .out = &res[0] };
-            count_chunk(&one);
+    chunk_result_t one;
+    chunk_result_t *res = &one;
+    pthread_t *ths = NULL;
+    chunk_args_t *args = NULL;
+    if (nthreads > 1) {
+        ths = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+        args = (chunk_args_t *)malloc(nthreads * sizeof(chunk_args_t));
+        res = (chunk_result_t *)malloc(nthreads * sizeof(chunk_result_t));
+        if (!ths || !args || !res) {
+            free(ths); free(args); free(res);
+            ths = NULL; args = NULL; res = &one;
             nthreads = 1;
-            break;
         }
     }
-    for (size_t i = 0; i < nthreads; ++i) pthread_join(ths[i], NULL);
-
-    size_t total_bytes = 0, total_lines = 0, total_words = 0;
-    for (size_t i = 0; i < nthreads; ++i) {
-        total_bytes += res[i].bytes;
-        total_lines += res[i].lines;
-        total_words += res[i].words;
-    }
-    for (size_t i = 0; i + 1 < nthreads; ++i) {
-        if (res[i].tail_word_char && res[i + 1].head_word_char) {
-            if (total_words > 0) total_words -= 1;
+    stats_engine("wc", nthreads > 1 ? "parallel" : "serial");
+    if (nthreads == 1) {
+        chunk_args_t a = { .data = data, .begin = 0, .end = size, .out = &one };
+        count_chunk(&a);
+    } else {
+        size_t base = 0;
+        size_t chunk = size / nthreads;
+        size_t rem = size % nthreads;
+        size_t started = 0;
+        for (size_t i = 0; i < nthreads; ++i) {
+            args[i].data = data;
+            args[i].begin = base;
+            args[i].end = base + chunk + (i < rem ? 1 : 0);
+            args[i].out = &res[i];
+            args[i].timed = 1;
+            base = args[i].end;
+            if (pthread_create(&ths[i], NULL, count_chunk, &args[i]) != 0) break;
+            started++;
         }
+        for (size_t i = 0; i < started; ++i) pthread_join(ths[i], NULL);
+        for (size_t i = started; i < nthreads; ++i) count_chunk(&args[i]);
     }
 
-    wc_result_t *r = (wc_result_t *)malloc(sizeof(wc_result_t));
-    if (!r) {
-        perror("wc: malloc result");
-        munmap(map, size);
-        free(ths); free(args); free(res);
-        return NULL;
+    for (size_t i = 0; i < nthreads; ++i) {
+        st->bytes += res[i].bytes;
+        st->lines += res[i].lines;
+        st->words += res[i].words;
+        int joined = i == 0 ? st->in_word : res[i - 1].tail_word_char;
+        if (joined && res[i].head_word_char) st->words -= 1;
     }
-    r->byte_cnt = total_bytes;
-    r->line_cnt = total_lines;
-    r->word_cnt = total_words;
+    st->in_word = res[nthreads - 1].tail_word_char;
+    if (res != &one) free(res);
+    free(ths); free(args);
+}
 
-    munmap(map, size);
-    free(ths); free(args); free(res);
-    return r;
+void wc_count(wc_state_t *st, const void *data, size_t size) {
+    count_block(st, (const unsigned char *)data, size, 1);
 }
 
-static wc_result_t *do_wc_streaming(int fd) {
-    size_t byte_cnt = 0; size_t word_cnt = 0; size_t line_cnt = 0;
-    char buf[8192]; bool in_word = false;
-    for (;;) {
-        ssize_t n = read(fd, buf, sizeof(buf));
-        if (n < 0) { perror("wc: read file"); close(fd); return NULL; }
-        if (n == 0) break;
-        byte_cnt += (size_t)n;
-        for (ssize_t i = 0; i < n; ++i) {
-            unsigned char ch = (unsigned char)buf[i];
-            if (ch == '\n') line_cnt++;
-            if (is_space_uc(ch)) { if (in_word) in_word = false; }
-            else { if (!in_word) { word_cnt++; in_word = true; } }
-        }
+wc_result_t* do_wc(const int fd) {
+    input_t in;
+    if (input_open(&in, fd, INPUT_AUTO) != 0) {
+        perror("wc: input");
+        close(fd);
+        return NULL;
+    }
+    wc_state_t st;
+    memset(&st, 0, sizeof(st));
+    const unsigned char *data;
+    ssize_t n;
+    while ((n = input_next(&in, &data)) > 0) count_block(&st, data, (size_t)n, 0);
+    if (n < 0) {
+        errno = in.error;
+        perror("wc: read file");
     }
+    input_close(&in);
     close(fd);
+    if (n < 0) return NULL;
     wc_result_t *r = (wc_result_t *)malloc(sizeof(wc_result_t));
     if (!r) { perror("wc: malloc"); return NULL; }
-    r->byte_cnt = byte_cnt; r->word_cnt = word_cnt; r->line_cnt = line_cnt;
+    r->byte_cnt = st.bytes; r->word_cnt = st.words; r->line_cnt = st.lines;
     return r;
 }
-
-wc_result_t* do_wc(const int fd) {
-    struct stat st;
-    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
-        wc_result_t *r = do_wc_mmap_mt(fd);
-        if (r) return r;
-        return do_wc_streaming(fd);
-    }
-    return do_wc_streaming(fd);
-}
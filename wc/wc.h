@@ -17,5 +17,19 @@ typedef struct wc_result wc_result_t;
 
 wc_result_t* do_wc(const int fd);
 
+// Running counts over consecutive blocks of one input.
+typedef struct wc_state {
+    size_t bytes;
+    size_t lines;
+    size_t words;
+    int in_word;    // the previous block ended inside a word
+} wc_state_t;
+
+// Counts the next block on the calling thread, for callers that already
+// hold the data (cksum --count).
+void wc_count(wc_state_t *st, const void *data, size_t size);
+// Command-line entry point; main() calls it unless built with UNIXC_MULTICALL.
+int wc_main(int argc, char **argv);
+
 
 #endif